@@ -0,0 +1,78 @@
+// Generated by scripts/moonlander_leds.py --keymap daedric, do not edit.
+#pragma once
+
+// Flash used: 78 bytes, 1080 bytes as a dense RGB table.
+
+enum led_colors {
+    LED_COLOR_BLACK,
+    LED_COLOR_GREEN,
+    LED_COLOR_PURPL,
+    LED_COLOR_RED,
+    LED_COLOR_GOLD,
+    LED_COLOR_WHITE,
+    LED_COLOR_ORANG,
+    LED_COLOR_BLUE,
+};
+
+// HSV palette converted to RGB at generation time
+const uint8_t PROGMEM led_palette[][3] = {
+    [LED_COLOR_BLACK] = {0x00, 0x00, 0x00},
+    [LED_COLOR_GREEN] = {0x00, 0xff, 0x00},
+    [LED_COLOR_PURPL] = {0x7e, 0x00, 0xff},
+    [LED_COLOR_RED]   = {0xff, 0x00, 0x00},
+    [LED_COLOR_GOLD]  = {0xff, 0xd8, 0x00},
+    [LED_COLOR_WHITE] = {0xff, 0xff, 0xff},
+    [LED_COLOR_ORANG] = {0xff, 0x7e, 0x00},
+    [LED_COLOR_BLUE]  = {0x0c, 0x00, 0xff},
+};
+
+typedef struct {
+    uint8_t led;
+    uint8_t color;
+} led_entry_t;
+
+typedef struct {
+    uint8_t offset;
+    uint8_t count;
+} led_layer_t;
+
+// LEDs set by each layer, the others show the layers below or stay off
+const led_entry_t PROGMEM ledmap_entries[] = {
+    // Base
+    {29, LED_COLOR_GREEN},
+    {32, LED_COLOR_PURPL},
+    {43, LED_COLOR_RED},
+    {47, LED_COLOR_GOLD},
+    {65, LED_COLOR_GREEN},
+    {68, LED_COLOR_PURPL},
+    // Qwerty
+    {29, LED_COLOR_GREEN},
+    {32, LED_COLOR_BLACK},
+    {43, LED_COLOR_RED},
+    {47, LED_COLOR_BLACK},
+    {65, LED_COLOR_GREEN},
+    {68, LED_COLOR_BLACK},
+    // Media
+    {14, LED_COLOR_RED},
+    {19, LED_COLOR_RED},
+    {36, LED_COLOR_ORANG},
+    {41, LED_COLOR_RED},
+    {55, LED_COLOR_BLUE},
+    {60, LED_COLOR_BLUE},
+    // Fn
+    {7, LED_COLOR_RED},
+    {12, LED_COLOR_RED},
+    {30, LED_COLOR_WHITE},
+    {31, LED_COLOR_WHITE},
+};
+
+// In the order of the layers of the keymap
+const led_layer_t PROGMEM ledmap[] = {
+    {0, 6},  // Base
+    {6, 6},  // Qwerty
+    {12, 0}, // Sym
+    {12, 6}, // Media
+    {18, 4}, // Fn
+};
+
+_Static_assert(sizeof(ledmap) / sizeof(ledmap[0]) == LAYER_COUNT, "ledmap.h is not generated for this keymap");
@@ -2,8 +2,8 @@
 LTO_ENABLE = yes
 UNICODE_COMMON = yes
 CONSOLE_ENABLE = no
-UNICODEMAP_ENABLE = yes
-KEY_OVERRIDE_ENABLE = yes
+# The keymap has its own 16 bits unicode_map, typed by the unicode queue
+UNICODEMAP_ENABLE = no
 
 
 NKRO_ENABLE = yes
@@ -14,4 +14,3 @@ AUTO_SHIFT_ENABLE = yes
 OS_DETECTION_ENABLE = yes
 AUTOCORRECT_ENABLE = yes
 
-SRC += daedric.c
@@ -0,0 +1,107 @@
+// Generated by scripts/moonlander_leds.py --keymap daedric_34, do not edit.
+#pragma once
+
+// Flash used: 134 bytes, 1512 bytes as a dense RGB table.
+
+enum led_colors {
+    LED_COLOR_BLACK,
+    LED_COLOR_GREEN,
+    LED_COLOR_PURPL,
+    LED_COLOR_RED,
+    LED_COLOR_GOLD,
+    LED_COLOR_WHITE,
+    LED_COLOR_ORANG,
+    LED_COLOR_BLUE,
+};
+
+// HSV palette converted to RGB at generation time
+const uint8_t PROGMEM led_palette[][3] = {
+    [LED_COLOR_BLACK] = {0x00, 0x00, 0x00},
+    [LED_COLOR_GREEN] = {0x00, 0xff, 0x00},
+    [LED_COLOR_PURPL] = {0x7e, 0x00, 0xff},
+    [LED_COLOR_RED]   = {0xff, 0x00, 0x00},
+    [LED_COLOR_GOLD]  = {0xff, 0xd8, 0x00},
+    [LED_COLOR_WHITE] = {0xff, 0xff, 0xff},
+    [LED_COLOR_ORANG] = {0xff, 0x7e, 0x00},
+    [LED_COLOR_BLUE]  = {0x0c, 0x00, 0xff},
+};
+
+typedef struct {
+    uint8_t led;
+    uint8_t color;
+} led_entry_t;
+
+typedef struct {
+    uint8_t offset;
+    uint8_t count;
+} led_layer_t;
+
+// LEDs set by each layer, the others show the layers below or stay off
+const led_entry_t PROGMEM ledmap_entries[] = {
+    // Base
+    {29, LED_COLOR_GREEN},
+    {32, LED_COLOR_PURPL},
+    {40, LED_COLOR_GREEN},
+    {43, LED_COLOR_RED},
+    {47, LED_COLOR_GOLD},
+    {65, LED_COLOR_GREEN},
+    {68, LED_COLOR_PURPL},
+    // Qwerty
+    {29, LED_COLOR_BLACK},
+    {32, LED_COLOR_BLACK},
+    {40, LED_COLOR_PURPL},
+    {43, LED_COLOR_RED},
+    {47, LED_COLOR_BLACK},
+    {65, LED_COLOR_BLACK},
+    {68, LED_COLOR_BLACK},
+    // Nav
+    {7, LED_COLOR_GOLD},
+    {12, LED_COLOR_GREEN},
+    {16, LED_COLOR_GREEN},
+    {17, LED_COLOR_GREEN},
+    {18, LED_COLOR_BLUE},
+    {22, LED_COLOR_GREEN},
+    {28, LED_COLOR_RED},
+    {47, LED_COLOR_ORANG},
+    {48, LED_COLOR_ORANG},
+    {49, LED_COLOR_ORANG},
+    {52, LED_COLOR_ORANG},
+    {53, LED_COLOR_ORANG},
+    {54, LED_COLOR_ORANG},
+    {57, LED_COLOR_ORANG},
+    {58, LED_COLOR_ORANG},
+    {59, LED_COLOR_ORANG},
+    {64, LED_COLOR_WHITE},
+    // Media
+    {13, LED_COLOR_RED},
+    {18, LED_COLOR_RED},
+    {37, LED_COLOR_ORANG},
+    {42, LED_COLOR_RED},
+    // Fn
+    {6, LED_COLOR_RED},
+    {7, LED_COLOR_GREEN},
+    {12, LED_COLOR_GREEN},
+    {17, LED_COLOR_GREEN},
+    {22, LED_COLOR_GREEN},
+    {27, LED_COLOR_GREEN},
+    {43, LED_COLOR_GREEN},
+    {48, LED_COLOR_GREEN},
+    {53, LED_COLOR_GREEN},
+    {58, LED_COLOR_GREEN},
+    {59, LED_COLOR_GREEN},
+    {63, LED_COLOR_GREEN},
+    {64, LED_COLOR_GREEN},
+};
+
+// In the order of the layers of the keymap
+const led_layer_t PROGMEM ledmap[] = {
+    {0, 7},   // Base
+    {7, 7},   // Qwerty
+    {14, 0},  // Sym
+    {14, 0},  // SymQwerty
+    {14, 17}, // Nav
+    {31, 4},  // Media
+    {35, 13}, // Fn
+};
+
+_Static_assert(sizeof(ledmap) / sizeof(ledmap[0]) == LAYER_COUNT, "ledmap.h is not generated for this keymap");
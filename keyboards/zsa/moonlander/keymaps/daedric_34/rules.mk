@@ -1,8 +1,8 @@
 # TAP_DANCE_ENABLE = yes
 LTO_ENABLE = yes
 UNICODE_COMMON = yes
-UNICODEMAP_ENABLE = yes
-KEY_OVERRIDE_ENABLE = yes
+# The keymap has its own 16 bits unicode_map, typed by the unicode queue
+UNICODEMAP_ENABLE = no
 CAPS_WORD_ENABLE = yes
 
 NKRO_ENABLE = yes
@@ -14,4 +14,6 @@ OS_DETECTION_ENABLE = yes
 AUTOCORRECT_ENABLE = yes
 TRI_LAYER_ENABLE = yes
 
-SRC += daedric.c
+# Share users/daedric with the daedric keymap
+USER_NAME := daedric
+
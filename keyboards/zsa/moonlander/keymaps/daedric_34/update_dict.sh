@@ -1 +0,0 @@
-qmk generate-autocorrect-data -kb moonlander -km ergol2  autocorrect_dictionary.txt
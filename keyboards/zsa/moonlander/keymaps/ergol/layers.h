@@ -0,0 +1,33 @@
+// Generated by scripts/gen_keymap.py, included by config.h
+
+#pragma once
+
+// Base, Sym, Fn
+#define LAYER_COUNT 3
+
+// The smallest layer_state_t for them
+// https://github.com/qmk/qmk_firmware/blob/a4da5f219fe0f202a07afa045fc0c08f6ce1f86b/docs/squeezing_avr.md#layers
+#define LAYER_STATE_8BIT
+#define RGBLIGHT_MAX_LAYERS 8
+
+// Keymaps in the firmware, std, and the layer of each
+// mode in them, see users/daedric/variants.h
+#define VARIANT_COUNT 1
+#define VARIANT_NO_LAYER 0xFF
+#define VARIANT_LAYERS_Base {0}
+#define VARIANT_LAYERS_Qwerty {VARIANT_NO_LAYER}
+#define VARIANT_LAYERS_Sym {1}
+#define VARIANT_LAYERS_SymQwerty {VARIANT_NO_LAYER}
+#define VARIANT_LAYERS_Nav {VARIANT_NO_LAYER}
+#define VARIANT_LAYERS_Num {VARIANT_NO_LAYER}
+#define VARIANT_LAYERS_Media {VARIANT_NO_LAYER}
+#define VARIANT_LAYERS_Fn {2}
+#define VARIANT_AUTOSHIFT {0}
+#define VARIANT_LAYER_INDEX {0, 1, 2}
+
+// Sizes of the tables of the keymap read by users/daedric
+#define KEYMAP_KEYS 72
+#define HOST_COUNT 2
+#define CUSTOM_KEY_COUNT 30
+#define UNICODE_MAP_COUNT 107
+#define UNICODE_ROUTE_COUNT 107
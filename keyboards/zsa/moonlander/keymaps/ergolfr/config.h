@@ -26,10 +26,9 @@
 #define RAW_USAGE_PAGE 0xFF60
 #define RAW_USAGE_ID 0x61
 
-// As long as I'm using <= 8 layers
-// https://github.com/qmk/qmk_firmware/blob/a4da5f219fe0f202a07afa045fc0c08f6ce1f86b/docs/squeezing_avr.md#layers
-#define LAYER_STATE_8BIT
-#define RGBLIGHT_MAX_LAYERS 8
+// LAYER_COUNT, the smallest LAYER_STATE_*BIT for it and the sizes of the
+// tables read by users/daedric, generated with the keymap by gen.sh
+#include "layers.h"
 
 // Default animation speed
 #define RGB_MATRIX_STARTUP_SPD 60
@@ -9,17 +9,25 @@
 #include "keymap_french.h"
 #include "sendstring_french.h"
 
+#include "custom_keys.h"
+#include "hosts.h"
+#include "sequences.h"
+#include "sparse_keymap.h"
+#include "unicode_queue.h"
+
 enum layers {
     Base,
-    DK,
     Sym,
     Fn,
 };
 
+// LAYER_COUNT, the width of layer_state_t and the sizes of the tables read
+// by users/daedric come from layers.h
+_Static_assert(Fn + 1 == LAYER_COUNT, "layers.h is out of date");
+_Static_assert(LAYER_COUNT <= sizeof(layer_state_t) * 8, "layer_state_t is too small for the layers");
+
 enum custom_keycodes {
-    _FIRST = SAFE_RANGE,
-    CKC_LMOVE_Base,
-    CKC_LMOVE_DK,
+    CKC_LMOVE_Base = KEYMAP_SAFE_RANGE,
     CKC_LMOVE_Sym,
     CKC_LMOVE_Fn,
     Base_EKC_1,
@@ -27,10 +35,6 @@ enum custom_keycodes {
     Base_EKC_3,
     Base_EKC_6,
     Base_EKC_SPC,
-    DK_EKC_C,
-    DK_EKC_A,
-    DK_EKC_S,
-    DK_EKC_E,
     Sym_EKC_C,
     Sym_EKC_O,
     Sym_EKC_W,
@@ -55,30 +59,8 @@ enum custom_keycodes {
     Sym_EKC_K,
 };
 
-#define DK_EKC_1 UP(DOUBLE_LOW_9_QUOTATION_MARK, SINGLE_LOW_9_QUOTATION_MARK)
-#define DK_EKC_2 UP(LEFT_DOUBLE_QUOTATION_MARK, LEFT_SINGLE_QUOTATION_MARK)
-#define DK_EKC_3 UP(RIGHT_DOUBLE_QUOTATION_MARK, RIGHT_SINGLE_QUOTATION_MARK)
-#define DK_EKC_4 UM(CENT_SIGN)
-#define DK_EKC_5 UM(PER_MILLE_SIGN)
-#define DK_EKC_9 UM(PILCROW_SIGN)
-#define DK_EKC_Q UP(LATIN_SMALL_LETTER_A_WITH_CIRCUMFLEX, LATIN_CAPITAL_LETTER_A_WITH_CIRCUMFLEX)
-#define DK_EKC_O UP(LATIN_SMALL_LIGATURE_OE, LATIN_CAPITAL_LIGATURE_OE)
-#define DK_EKC_P UP(LATIN_SMALL_LETTER_O_WITH_CIRCUMFLEX, LATIN_CAPITAL_LETTER_O_WITH_CIRCUMFLEX)
-#define DK_EKC_M UM(MICRO_SIGN)
-#define DK_EKC_DK UP(COMBINING_DIAERESIS, INVERTED_EXCLAMATION_MARK)
-#define DK_EKC_Y UP(LATIN_SMALL_LETTER_U_WITH_CIRCUMFLEX, LATIN_CAPITAL_LETTER_U_WITH_CIRCUMFLEX)
-#define DK_EKC_N UP(LATIN_SMALL_LETTER_E_WITH_CIRCUMFLEX, LATIN_CAPITAL_LETTER_E_WITH_CIRCUMFLEX)
-#define DK_EKC_F UP(LATIN_SMALL_LETTER_N_WITH_TILDE, LATIN_CAPITAL_LETTER_N_WITH_TILDE)
-#define DK_EKC_T UP(LATIN_SMALL_LETTER_I_WITH_CIRCUMFLEX, LATIN_CAPITAL_LETTER_I_WITH_CIRCUMFLEX)
-#define DK_EKC_I UP(LATIN_SMALL_LETTER_I_WITH_DIAERESIS, LATIN_CAPITAL_LETTER_I_WITH_DIAERESIS)
-#define DK_EKC_Z UP(LATIN_SMALL_LETTER_AE, LATIN_CAPITAL_LETTER_AE)
-#define DK_EKC_X UP(LATIN_SMALL_LETTER_SHARP_S, LATIN_CAPITAL_LETTER_SHARP_S)
-#define DK_EKC_MNS UP(NON_BREAKING_HYPHEN, INVERTED_QUESTION_MARK)
-#define DK_EKC_V UM(EN_DASH)
-#define DK_EKC_B UM(EM_DASH)
-#define DK_EKC_DOT UM(HORIZONTAL_ELLIPSIS)
-#define DK_EKC_COMM UP(MIDDLE_DOT, BULLET)
-#define DK_EKC_SPC UM(RIGHT_SINGLE_QUOTATION_MARK)
+_Static_assert(Sym_EKC_K - KEYMAP_SAFE_RANGE + 1 == CUSTOM_KEY_COUNT, "layers.h is out of date");
+
 #define Sym_EKC_1 UP(SUBSCRIPT_ONE, SUPERSCRIPT_ONE)
 #define Sym_EKC_2 UP(SUBSCRIPT_TWO, SUPERSCRIPT_TWO)
 #define Sym_EKC_3 UP(SUBSCRIPT_THREE, SUPERSCRIPT_THREE)
@@ -92,84 +74,84 @@ enum custom_keycodes {
 #define Sym_EKC_Q UP(CIRCUMFLEX_ACCENT, COMBINING_CIRCUMFLEX_ACCENT)
 
 enum unicode_names {
-    LATIN_SMALL_LETTER_A_WITH_CIRCUMFLEX,
-    LATIN_CAPITAL_LETTER_A_WITH_CIRCUMFLEX,
     CIRCUMFLEX_ACCENT,
     COMBINING_CIRCUMFLEX_ACCENT,
-    LATIN_CAPITAL_LETTER_C_WITH_CEDILLA,
+    LATIN_SMALL_LETTER_A_WITH_CIRCUMFLEX,
+    LATIN_CAPITAL_LETTER_A_WITH_CIRCUMFLEX,
     LESS_THAN_OR_EQUAL_TO,
+    LATIN_CAPITAL_LETTER_C_WITH_CEDILLA,
+    GREATER_THAN_OR_EQUAL_TO,
     LATIN_SMALL_LIGATURE_OE,
     LATIN_CAPITAL_LIGATURE_OE,
-    GREATER_THAN_OR_EQUAL_TO,
     LATIN_SMALL_LETTER_O_WITH_CIRCUMFLEX,
     LATIN_CAPITAL_LETTER_O_WITH_CIRCUMFLEX,
     PER_MILLE_SIGN,
     COMBINING_RING_ABOVE,
     MICRO_SIGN,
     MULTIPLICATION_SIGN,
+    COMBINING_ACUTE_ACCENT,
     COMBINING_DIAERESIS,
     INVERTED_EXCLAMATION_MARK,
-    COMBINING_ACUTE_ACCENT,
+    COMBINING_GRAVE_ACCENT,
     LATIN_SMALL_LETTER_U_WITH_CIRCUMFLEX,
     LATIN_CAPITAL_LETTER_U_WITH_CIRCUMFLEX,
-    COMBINING_GRAVE_ACCENT,
-    LATIN_CAPITAL_LETTER_A_WITH_GRAVE,
     COMBINING_CARON,
+    LATIN_CAPITAL_LETTER_A_WITH_GRAVE,
     LATIN_CAPITAL_LETTER_E_WITH_ACUTE,
     LATIN_CAPITAL_LETTER_E_WITH_GRAVE,
+    COMBINING_DOT_ABOVE,
     LATIN_SMALL_LETTER_E_WITH_CIRCUMFLEX,
     LATIN_CAPITAL_LETTER_E_WITH_CIRCUMFLEX,
-    COMBINING_DOT_ABOVE,
+    NOT_EQUAL_TO,
     LATIN_SMALL_LETTER_N_WITH_TILDE,
     LATIN_CAPITAL_LETTER_N_WITH_TILDE,
-    NOT_EQUAL_TO,
     COMBINING_LONG_SOLIDUS_OVERLAY,
     PLUS_SIGN_ABOVE_EQUALS_SIGN,
+    COMBINING_MACRON,
     LATIN_SMALL_LETTER_I_WITH_CIRCUMFLEX,
     LATIN_CAPITAL_LETTER_I_WITH_CIRCUMFLEX,
-    COMBINING_MACRON,
+    DIVISION_SIGN,
     LATIN_SMALL_LETTER_I_WITH_DIAERESIS,
     LATIN_CAPITAL_LETTER_I_WITH_DIAERESIS,
-    DIVISION_SIGN,
+    COMBINING_DOUBLE_ACUTE_ACCENT,
     LATIN_SMALL_LETTER_U_WITH_GRAVE,
     LATIN_CAPITAL_LETTER_U_WITH_GRAVE,
-    COMBINING_DOUBLE_ACUTE_ACCENT,
+    COMBINING_TILDE,
     LATIN_SMALL_LETTER_AE,
     LATIN_CAPITAL_LETTER_AE,
-    COMBINING_TILDE,
+    COMBINING_COMMA_BELOW,
     LATIN_SMALL_LETTER_SHARP_S,
     LATIN_CAPITAL_LETTER_SHARP_S,
-    COMBINING_COMMA_BELOW,
+    COMBINING_OGONEK,
     NON_BREAKING_HYPHEN,
     INVERTED_QUESTION_MARK,
-    COMBINING_OGONEK,
     EN_DASH,
     EM_DASH,
-    HORIZONTAL_ELLIPSIS,
     BROKEN_BAR,
+    HORIZONTAL_ELLIPSIS,
     NOT_SIGN,
     COMBINING_TURNED_COMMA_ABOVE,
     MIDDLE_DOT,
     BULLET,
     COMBINING_BREVE,
     EURO_SIGN,
-    DOUBLE_LOW_9_QUOTATION_MARK,
-    SINGLE_LOW_9_QUOTATION_MARK,
     SUBSCRIPT_ONE,
     SUPERSCRIPT_ONE,
+    DOUBLE_LOW_9_QUOTATION_MARK,
+    SINGLE_LOW_9_QUOTATION_MARK,
     LEFT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK,
-    LEFT_DOUBLE_QUOTATION_MARK,
-    LEFT_SINGLE_QUOTATION_MARK,
     SUBSCRIPT_TWO,
     SUPERSCRIPT_TWO,
+    LEFT_DOUBLE_QUOTATION_MARK,
+    LEFT_SINGLE_QUOTATION_MARK,
     RIGHT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK,
-    RIGHT_DOUBLE_QUOTATION_MARK,
-    RIGHT_SINGLE_QUOTATION_MARK,
     SUBSCRIPT_THREE,
     SUPERSCRIPT_THREE,
-    CENT_SIGN,
+    RIGHT_DOUBLE_QUOTATION_MARK,
+    RIGHT_SINGLE_QUOTATION_MARK,
     SUBSCRIPT_FOUR,
     SUPERSCRIPT_FOUR,
+    CENT_SIGN,
     SUBSCRIPT_FIVE,
     SUPERSCRIPT_FIVE,
     SUBSCRIPT_SIX,
@@ -178,93 +160,105 @@ enum unicode_names {
     SUPERSCRIPT_SEVEN,
     SUBSCRIPT_EIGHT,
     SUPERSCRIPT_EIGHT,
-    PILCROW_SIGN,
     SUBSCRIPT_NINE,
     SUPERSCRIPT_NINE,
+    PILCROW_SIGN,
     SUBSCRIPT_ZERO,
     SUPERSCRIPT_ZERO,
     NARROW_NO_BREAK_SPACE,
+    LATIN_SMALL_LETTER_A_WITH_DIAERESIS,
+    LATIN_CAPITAL_LETTER_A_WITH_DIAERESIS,
+    LATIN_SMALL_LETTER_E_WITH_DIAERESIS,
+    LATIN_CAPITAL_LETTER_E_WITH_DIAERESIS,
+    LATIN_SMALL_LETTER_O_WITH_DIAERESIS,
+    LATIN_CAPITAL_LETTER_O_WITH_DIAERESIS,
+    LATIN_SMALL_LETTER_U_WITH_DIAERESIS,
+    LATIN_CAPITAL_LETTER_U_WITH_DIAERESIS,
+    LATIN_SMALL_LETTER_Y_WITH_DIAERESIS,
+    LATIN_CAPITAL_LETTER_Y_WITH_DIAERESIS,
 };
 
-const uint32_t PROGMEM unicode_map[] = {
-    [LATIN_SMALL_LETTER_A_WITH_CIRCUMFLEX]       = 0x00e2 /* â */,
-    [LATIN_CAPITAL_LETTER_A_WITH_CIRCUMFLEX]     = 0x00c2 /* Â */,
+_Static_assert(LATIN_CAPITAL_LETTER_Y_WITH_DIAERESIS + 1 == UNICODE_MAP_COUNT, "layers.h is out of date");
+
+const uint16_t PROGMEM unicode_map[] = {
     [CIRCUMFLEX_ACCENT]                          = 0x005e /* ^ */,
     [COMBINING_CIRCUMFLEX_ACCENT]                = 0x0302 /* ̂ */,
-    [LATIN_CAPITAL_LETTER_C_WITH_CEDILLA]        = 0x00c7 /* Ç */,
+    [LATIN_SMALL_LETTER_A_WITH_CIRCUMFLEX]       = 0x00e2 /* â */,
+    [LATIN_CAPITAL_LETTER_A_WITH_CIRCUMFLEX]     = 0x00c2 /* Â */,
     [LESS_THAN_OR_EQUAL_TO]                      = 0x2264 /* ≤ */,
+    [LATIN_CAPITAL_LETTER_C_WITH_CEDILLA]        = 0x00c7 /* Ç */,
+    [GREATER_THAN_OR_EQUAL_TO]                   = 0x2265 /* ≥ */,
     [LATIN_SMALL_LIGATURE_OE]                    = 0x0153 /* œ */,
     [LATIN_CAPITAL_LIGATURE_OE]                  = 0x0152 /* Œ */,
-    [GREATER_THAN_OR_EQUAL_TO]                   = 0x2265 /* ≥ */,
     [LATIN_SMALL_LETTER_O_WITH_CIRCUMFLEX]       = 0x00f4 /* ô */,
     [LATIN_CAPITAL_LETTER_O_WITH_CIRCUMFLEX]     = 0x00d4 /* Ô */,
     [PER_MILLE_SIGN]                             = 0x2030 /* ‰ */,
     [COMBINING_RING_ABOVE]                       = 0x030a /* ̊ */,
     [MICRO_SIGN]                                 = 0x00b5 /* µ */,
     [MULTIPLICATION_SIGN]                        = 0x00d7 /* × */,
+    [COMBINING_ACUTE_ACCENT]                     = 0x0301 /* ́ */,
     [COMBINING_DIAERESIS]                        = 0x0308 /* ̈ */,
     [INVERTED_EXCLAMATION_MARK]                  = 0x00a1 /* ¡ */,
-    [COMBINING_ACUTE_ACCENT]                     = 0x0301 /* ́ */,
+    [COMBINING_GRAVE_ACCENT]                     = 0x0300 /* ̀ */,
     [LATIN_SMALL_LETTER_U_WITH_CIRCUMFLEX]       = 0x00fb /* û */,
     [LATIN_CAPITAL_LETTER_U_WITH_CIRCUMFLEX]     = 0x00db /* Û */,
-    [COMBINING_GRAVE_ACCENT]                     = 0x0300 /* ̀ */,
-    [LATIN_CAPITAL_LETTER_A_WITH_GRAVE]          = 0x00c0 /* À */,
     [COMBINING_CARON]                            = 0x030c /* ̌ */,
+    [LATIN_CAPITAL_LETTER_A_WITH_GRAVE]          = 0x00c0 /* À */,
     [LATIN_CAPITAL_LETTER_E_WITH_ACUTE]          = 0x00c9 /* É */,
     [LATIN_CAPITAL_LETTER_E_WITH_GRAVE]          = 0x00c8 /* È */,
+    [COMBINING_DOT_ABOVE]                        = 0x0307 /* ̇ */,
     [LATIN_SMALL_LETTER_E_WITH_CIRCUMFLEX]       = 0x00ea /* ê */,
     [LATIN_CAPITAL_LETTER_E_WITH_CIRCUMFLEX]     = 0x00ca /* Ê */,
-    [COMBINING_DOT_ABOVE]                        = 0x0307 /* ̇ */,
+    [NOT_EQUAL_TO]                               = 0x2260 /* ≠ */,
     [LATIN_SMALL_LETTER_N_WITH_TILDE]            = 0x00f1 /* ñ */,
     [LATIN_CAPITAL_LETTER_N_WITH_TILDE]          = 0x00d1 /* Ñ */,
-    [NOT_EQUAL_TO]                               = 0x2260 /* ≠ */,
     [COMBINING_LONG_SOLIDUS_OVERLAY]             = 0x0338 /* ̸ */,
     [PLUS_SIGN_ABOVE_EQUALS_SIGN]                = 0x2a72 /* ⩲ */,
+    [COMBINING_MACRON]                           = 0x0304 /* ̄ */,
     [LATIN_SMALL_LETTER_I_WITH_CIRCUMFLEX]       = 0x00ee /* î */,
     [LATIN_CAPITAL_LETTER_I_WITH_CIRCUMFLEX]     = 0x00ce /* Î */,
-    [COMBINING_MACRON]                           = 0x0304 /* ̄ */,
+    [DIVISION_SIGN]                              = 0x00f7 /* ÷ */,
     [LATIN_SMALL_LETTER_I_WITH_DIAERESIS]        = 0x00ef /* ï */,
     [LATIN_CAPITAL_LETTER_I_WITH_DIAERESIS]      = 0x00cf /* Ï */,
-    [DIVISION_SIGN]                              = 0x00f7 /* ÷ */,
+    [COMBINING_DOUBLE_ACUTE_ACCENT]              = 0x030b /* ̋ */,
     [LATIN_SMALL_LETTER_U_WITH_GRAVE]            = 0x00f9 /* ù */,
     [LATIN_CAPITAL_LETTER_U_WITH_GRAVE]          = 0x00d9 /* Ù */,
-    [COMBINING_DOUBLE_ACUTE_ACCENT]              = 0x030b /* ̋ */,
+    [COMBINING_TILDE]                            = 0x0303 /* ̃ */,
     [LATIN_SMALL_LETTER_AE]                      = 0x00e6 /* æ */,
     [LATIN_CAPITAL_LETTER_AE]                    = 0x00c6 /* Æ */,
-    [COMBINING_TILDE]                            = 0x0303 /* ̃ */,
+    [COMBINING_COMMA_BELOW]                      = 0x0326 /* ̦ */,
     [LATIN_SMALL_LETTER_SHARP_S]                 = 0x00df /* ß */,
     [LATIN_CAPITAL_LETTER_SHARP_S]               = 0x1e9e /* ẞ */,
-    [COMBINING_COMMA_BELOW]                      = 0x0326 /* ̦ */,
+    [COMBINING_OGONEK]                           = 0x0328 /* ̨ */,
     [NON_BREAKING_HYPHEN]                        = 0x2011 /* ‑ */,
     [INVERTED_QUESTION_MARK]                     = 0x00bf /* ¿ */,
-    [COMBINING_OGONEK]                           = 0x0328 /* ̨ */,
     [EN_DASH]                                    = 0x2013 /* – */,
     [EM_DASH]                                    = 0x2014 /* — */,
-    [HORIZONTAL_ELLIPSIS]                        = 0x2026 /* … */,
     [BROKEN_BAR]                                 = 0x00a6 /* ¦ */,
+    [HORIZONTAL_ELLIPSIS]                        = 0x2026 /* … */,
     [NOT_SIGN]                                   = 0x00ac /* ¬ */,
     [COMBINING_TURNED_COMMA_ABOVE]               = 0x0312 /* ̒ */,
     [MIDDLE_DOT]                                 = 0x00b7 /* · */,
     [BULLET]                                     = 0x2022 /* • */,
     [COMBINING_BREVE]                            = 0x0306 /* ̆ */,
     [EURO_SIGN]                                  = 0x20ac /* € */,
-    [DOUBLE_LOW_9_QUOTATION_MARK]                = 0x201e /* „ */,
-    [SINGLE_LOW_9_QUOTATION_MARK]                = 0x201a /* ‚ */,
     [SUBSCRIPT_ONE]                              = 0x2081 /* ₁ */,
     [SUPERSCRIPT_ONE]                            = 0x00b9 /* ¹ */,
+    [DOUBLE_LOW_9_QUOTATION_MARK]                = 0x201e /* „ */,
+    [SINGLE_LOW_9_QUOTATION_MARK]                = 0x201a /* ‚ */,
     [LEFT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK]  = 0x00ab /* « */,
-    [LEFT_DOUBLE_QUOTATION_MARK]                 = 0x201c /* “ */,
-    [LEFT_SINGLE_QUOTATION_MARK]                 = 0x2018 /* ‘ */,
     [SUBSCRIPT_TWO]                              = 0x2082 /* ₂ */,
     [SUPERSCRIPT_TWO]                            = 0x00b2 /* ² */,
+    [LEFT_DOUBLE_QUOTATION_MARK]                 = 0x201c /* “ */,
+    [LEFT_SINGLE_QUOTATION_MARK]                 = 0x2018 /* ‘ */,
     [RIGHT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK] = 0x00bb /* » */,
-    [RIGHT_DOUBLE_QUOTATION_MARK]                = 0x201d /* ” */,
-    [RIGHT_SINGLE_QUOTATION_MARK]                = 0x2019 /* ’ */,
     [SUBSCRIPT_THREE]                            = 0x2083 /* ₃ */,
     [SUPERSCRIPT_THREE]                          = 0x00b3 /* ³ */,
-    [CENT_SIGN]                                  = 0x00a2 /* ¢ */,
+    [RIGHT_DOUBLE_QUOTATION_MARK]                = 0x201d /* ” */,
+    [RIGHT_SINGLE_QUOTATION_MARK]                = 0x2019 /* ’ */,
     [SUBSCRIPT_FOUR]                             = 0x2084 /* ₄ */,
     [SUPERSCRIPT_FOUR]                           = 0x2074 /* ⁴ */,
+    [CENT_SIGN]                                  = 0x00a2 /* ¢ */,
     [SUBSCRIPT_FIVE]                             = 0x2085 /* ₅ */,
     [SUPERSCRIPT_FIVE]                           = 0x2075 /* ⁵ */,
     [SUBSCRIPT_SIX]                              = 0x2086 /* ₆ */,
@@ -273,293 +267,447 @@ const uint32_t PROGMEM unicode_map[] = {
     [SUPERSCRIPT_SEVEN]                          = 0x2077 /* ⁷ */,
     [SUBSCRIPT_EIGHT]                            = 0x2088 /* ₈ */,
     [SUPERSCRIPT_EIGHT]                          = 0x2078 /* ⁸ */,
-    [PILCROW_SIGN]                               = 0x00b6 /* ¶ */,
     [SUBSCRIPT_NINE]                             = 0x2089 /* ₉ */,
     [SUPERSCRIPT_NINE]                           = 0x2079 /* ⁹ */,
+    [PILCROW_SIGN]                               = 0x00b6 /* ¶ */,
     [SUBSCRIPT_ZERO]                             = 0x2080 /* ₀ */,
     [SUPERSCRIPT_ZERO]                           = 0x2070 /* ⁰ */,
     [NARROW_NO_BREAK_SPACE]                      = 0x202f /*   */,
+    [LATIN_SMALL_LETTER_A_WITH_DIAERESIS]        = 0x00e4 /* ä */,
+    [LATIN_CAPITAL_LETTER_A_WITH_DIAERESIS]      = 0x00c4 /* Ä */,
+    [LATIN_SMALL_LETTER_E_WITH_DIAERESIS]        = 0x00eb /* ë */,
+    [LATIN_CAPITAL_LETTER_E_WITH_DIAERESIS]      = 0x00cb /* Ë */,
+    [LATIN_SMALL_LETTER_O_WITH_DIAERESIS]        = 0x00f6 /* ö */,
+    [LATIN_CAPITAL_LETTER_O_WITH_DIAERESIS]      = 0x00d6 /* Ö */,
+    [LATIN_SMALL_LETTER_U_WITH_DIAERESIS]        = 0x00fc /* ü */,
+    [LATIN_CAPITAL_LETTER_U_WITH_DIAERESIS]      = 0x00dc /* Ü */,
+    [LATIN_SMALL_LETTER_Y_WITH_DIAERESIS]        = 0x00ff /* ÿ */,
+    [LATIN_CAPITAL_LETTER_Y_WITH_DIAERESIS]      = 0x0178 /* Ÿ */,
+};
+
+const uint16_t PROGMEM unicode_route_keys[] = {
+    FR_CIRC,          // ^
+    FR_DCIR, FR_A,    // â
+    FR_DCIR, S(FR_A), // Â
+    FR_DCIR, FR_O,    // ô
+    FR_DCIR, S(FR_O), // Ô
+    FR_MICR,          // µ
+    FR_DCIR, FR_U,    // û
+    FR_DCIR, S(FR_U), // Û
+    FR_GRV, S(FR_A),  // À
+    FR_GRV, S(FR_E),  // È
+    FR_DCIR, FR_E,    // ê
+    FR_DCIR, S(FR_E), // Ê
+    FR_TILD, FR_N,    // ñ
+    FR_TILD, S(FR_N), // Ñ
+    FR_DCIR, FR_I,    // î
+    FR_DCIR, S(FR_I), // Î
+    FR_DIAE, FR_I,    // ï
+    FR_DIAE, S(FR_I), // Ï
+    FR_UGRV,          // ù
+    FR_GRV, S(FR_U),  // Ù
+    FR_EURO,          // €
+    FR_SUP2,          // ²
+    FR_DIAE, FR_A,    // ä
+    FR_DIAE, S(FR_A), // Ä
+    FR_DIAE, FR_E,    // ë
+    FR_DIAE, S(FR_E), // Ë
+    FR_DIAE, FR_O,    // ö
+    FR_DIAE, S(FR_O), // Ö
+    FR_DIAE, FR_U,    // ü
+    FR_DIAE, S(FR_U), // Ü
+    FR_DIAE, FR_Y,    // ÿ
+    FR_DIAE, S(FR_Y), // Ÿ
 };
 
-const key_override_t Base_EKC_4    = ko_make_with_layers(MOD_MASK_SHIFT, FR_4, FR_DLR, (1 << Base));
-const key_override_t Base_EKC_5    = ko_make_with_layers(MOD_MASK_SHIFT, FR_5, FR_PERC, (1 << Base));
-const key_override_t Base_EKC_7    = ko_make_with_layers(MOD_MASK_SHIFT, FR_7, FR_AMPR, (1 << Base));
-const key_override_t Base_EKC_8    = ko_make_with_layers(MOD_MASK_SHIFT, FR_8, FR_ASTR, (1 << Base));
-const key_override_t Base_EKC_9    = ko_make_with_layers(MOD_MASK_SHIFT, FR_9, FR_HASH, (1 << Base));
-const key_override_t Base_EKC_0    = ko_make_with_layers(MOD_MASK_SHIFT, FR_0, FR_AT, (1 << Base));
-const key_override_t Base_EKC_DK   = ko_make_with_layers(MOD_MASK_SHIFT, OSL(DK), KC_EXLM, (1 << Base));
-const key_override_t Base_EKC_MNS  = ko_make_with_layers(MOD_MASK_SHIFT, FR_MINS, FR_QUES, (1 << Base));
-const key_override_t Base_EKC_DOT  = ko_make_with_layers(MOD_MASK_SHIFT, FR_DOT, FR_COLN, (1 << Base));
-const key_override_t Base_EKC_COMM = ko_make_with_layers(MOD_MASK_SHIFT, FR_COMM, FR_SCLN, (1 << Base));
-const key_override_t DK_EKC_8      = ko_make_with_layers(MOD_MASK_SHIFT, FR_SECT, FR_SECT, (1 << DK));
-const key_override_t DK_EKC_0      = ko_make_with_layers(MOD_MASK_SHIFT, FR_DEG, FR_DEG, (1 << DK));
-const key_override_t DK_EKC_D      = ko_make_with_layers(MOD_MASK_SHIFT, FR_UNDS, FR_UNDS, (1 << DK));
-const key_override_t DK_EKC_L      = ko_make_with_layers(MOD_MASK_SHIFT, FR_LPRN, FR_LPRN, (1 << DK));
-const key_override_t DK_EKC_R      = ko_make_with_layers(MOD_MASK_SHIFT, FR_RPRN, FR_RPRN, (1 << DK));
-const key_override_t Sym_EKC_P     = ko_make_with_layers(MOD_MASK_SHIFT, FR_DLR, FR_DLR, (1 << Sym));
-const key_override_t Sym_EKC_M     = ko_make_with_layers(MOD_MASK_SHIFT, FR_AMPR, FR_AMPR, (1 << Sym));
-const key_override_t Sym_EKC_S     = ko_make_with_layers(MOD_MASK_SHIFT, FR_LPRN, FR_LPRN, (1 << Sym));
-const key_override_t Sym_EKC_E     = ko_make_with_layers(MOD_MASK_SHIFT, FR_RPRN, FR_RPRN, (1 << Sym));
-const key_override_t Sym_EKC_B     = ko_make_with_layers(MOD_MASK_SHIFT, FR_HASH, FR_HASH, (1 << Sym));
-const key_override_t Sym_EKC_COMM  = ko_make_with_layers(MOD_MASK_SHIFT, FR_COLN, FR_COLN, (1 << Sym));
-const key_override_t Sym_EKC_SPC   = ko_make_with_layers(MOD_MASK_SHIFT, KC_SPC, KC_SPC, (1 << Sym));
-
-const key_override_t *key_overrides[] = (const key_override_t *[]){
-    &Base_EKC_4, &Base_EKC_5, &Base_EKC_7, &Base_EKC_8, &Base_EKC_9, &Base_EKC_0, &Base_EKC_DK, &Base_EKC_MNS, &Base_EKC_DOT, &Base_EKC_COMM, &DK_EKC_8, &DK_EKC_0, &DK_EKC_D, &DK_EKC_L, &DK_EKC_R, &Sym_EKC_P, &Sym_EKC_M, &Sym_EKC_S, &Sym_EKC_E, &Sym_EKC_B, &Sym_EKC_COMM, &Sym_EKC_SPC, NULL,
+const unicode_route_t PROGMEM unicode_routes[UNICODE_ROUTE_COUNT][UNICODE_MODE_COUNT] = {
+    [CIRCUMFLEX_ACCENT]                      = {[UNICODE_MODE_LINUX] = {0, 1}, [UNICODE_MODE_WINDOWS] = {0, 1}, [UNICODE_MODE_BSD] = {0, 1}, [UNICODE_MODE_WINCOMPOSE] = {0, 1}, [UNICODE_MODE_EMACS] = {0, 1}},
+    [LATIN_SMALL_LETTER_A_WITH_CIRCUMFLEX]   = {[UNICODE_MODE_LINUX] = {1, 2}, [UNICODE_MODE_WINDOWS] = {1, 2}, [UNICODE_MODE_BSD] = {1, 2}, [UNICODE_MODE_WINCOMPOSE] = {1, 2}, [UNICODE_MODE_EMACS] = {1, 2}},
+    [LATIN_CAPITAL_LETTER_A_WITH_CIRCUMFLEX] = {[UNICODE_MODE_LINUX] = {3, 2}, [UNICODE_MODE_WINDOWS] = {3, 2}, [UNICODE_MODE_BSD] = {3, 2}, [UNICODE_MODE_WINCOMPOSE] = {3, 2}, [UNICODE_MODE_EMACS] = {3, 2}},
+    [LATIN_SMALL_LETTER_O_WITH_CIRCUMFLEX]   = {[UNICODE_MODE_LINUX] = {5, 2}, [UNICODE_MODE_WINDOWS] = {5, 2}, [UNICODE_MODE_BSD] = {5, 2}, [UNICODE_MODE_WINCOMPOSE] = {5, 2}, [UNICODE_MODE_EMACS] = {5, 2}},
+    [LATIN_CAPITAL_LETTER_O_WITH_CIRCUMFLEX] = {[UNICODE_MODE_LINUX] = {7, 2}, [UNICODE_MODE_WINDOWS] = {7, 2}, [UNICODE_MODE_BSD] = {7, 2}, [UNICODE_MODE_WINCOMPOSE] = {7, 2}, [UNICODE_MODE_EMACS] = {7, 2}},
+    [MICRO_SIGN]                             = {[UNICODE_MODE_LINUX] = {9, 1}, [UNICODE_MODE_WINDOWS] = {9, 1}, [UNICODE_MODE_BSD] = {9, 1}, [UNICODE_MODE_WINCOMPOSE] = {9, 1}, [UNICODE_MODE_EMACS] = {9, 1}},
+    [LATIN_SMALL_LETTER_U_WITH_CIRCUMFLEX]   = {[UNICODE_MODE_LINUX] = {10, 2}, [UNICODE_MODE_WINDOWS] = {10, 2}, [UNICODE_MODE_BSD] = {10, 2}, [UNICODE_MODE_WINCOMPOSE] = {10, 2}, [UNICODE_MODE_EMACS] = {10, 2}},
+    [LATIN_CAPITAL_LETTER_U_WITH_CIRCUMFLEX] = {[UNICODE_MODE_LINUX] = {12, 2}, [UNICODE_MODE_WINDOWS] = {12, 2}, [UNICODE_MODE_BSD] = {12, 2}, [UNICODE_MODE_WINCOMPOSE] = {12, 2}, [UNICODE_MODE_EMACS] = {12, 2}},
+    [LATIN_CAPITAL_LETTER_A_WITH_GRAVE]      = {[UNICODE_MODE_LINUX] = {14, 2}, [UNICODE_MODE_WINDOWS] = {14, 2}, [UNICODE_MODE_BSD] = {14, 2}, [UNICODE_MODE_WINCOMPOSE] = {14, 2}, [UNICODE_MODE_EMACS] = {14, 2}},
+    [LATIN_CAPITAL_LETTER_E_WITH_GRAVE]      = {[UNICODE_MODE_LINUX] = {16, 2}, [UNICODE_MODE_WINDOWS] = {16, 2}, [UNICODE_MODE_BSD] = {16, 2}, [UNICODE_MODE_WINCOMPOSE] = {16, 2}, [UNICODE_MODE_EMACS] = {16, 2}},
+    [LATIN_SMALL_LETTER_E_WITH_CIRCUMFLEX]   = {[UNICODE_MODE_LINUX] = {18, 2}, [UNICODE_MODE_WINDOWS] = {18, 2}, [UNICODE_MODE_BSD] = {18, 2}, [UNICODE_MODE_WINCOMPOSE] = {18, 2}, [UNICODE_MODE_EMACS] = {18, 2}},
+    [LATIN_CAPITAL_LETTER_E_WITH_CIRCUMFLEX] = {[UNICODE_MODE_LINUX] = {20, 2}, [UNICODE_MODE_WINDOWS] = {20, 2}, [UNICODE_MODE_BSD] = {20, 2}, [UNICODE_MODE_WINCOMPOSE] = {20, 2}, [UNICODE_MODE_EMACS] = {20, 2}},
+    [LATIN_SMALL_LETTER_N_WITH_TILDE]        = {[UNICODE_MODE_LINUX] = {22, 2}, [UNICODE_MODE_WINDOWS] = {22, 2}, [UNICODE_MODE_BSD] = {22, 2}, [UNICODE_MODE_WINCOMPOSE] = {22, 2}, [UNICODE_MODE_EMACS] = {22, 2}},
+    [LATIN_CAPITAL_LETTER_N_WITH_TILDE]      = {[UNICODE_MODE_LINUX] = {24, 2}, [UNICODE_MODE_WINDOWS] = {24, 2}, [UNICODE_MODE_BSD] = {24, 2}, [UNICODE_MODE_WINCOMPOSE] = {24, 2}, [UNICODE_MODE_EMACS] = {24, 2}},
+    [LATIN_SMALL_LETTER_I_WITH_CIRCUMFLEX]   = {[UNICODE_MODE_LINUX] = {26, 2}, [UNICODE_MODE_WINDOWS] = {26, 2}, [UNICODE_MODE_BSD] = {26, 2}, [UNICODE_MODE_WINCOMPOSE] = {26, 2}, [UNICODE_MODE_EMACS] = {26, 2}},
+    [LATIN_CAPITAL_LETTER_I_WITH_CIRCUMFLEX] = {[UNICODE_MODE_LINUX] = {28, 2}, [UNICODE_MODE_WINDOWS] = {28, 2}, [UNICODE_MODE_BSD] = {28, 2}, [UNICODE_MODE_WINCOMPOSE] = {28, 2}, [UNICODE_MODE_EMACS] = {28, 2}},
+    [LATIN_SMALL_LETTER_I_WITH_DIAERESIS]    = {[UNICODE_MODE_LINUX] = {30, 2}, [UNICODE_MODE_WINDOWS] = {30, 2}, [UNICODE_MODE_BSD] = {30, 2}, [UNICODE_MODE_WINCOMPOSE] = {30, 2}, [UNICODE_MODE_EMACS] = {30, 2}},
+    [LATIN_CAPITAL_LETTER_I_WITH_DIAERESIS]  = {[UNICODE_MODE_LINUX] = {32, 2}, [UNICODE_MODE_WINDOWS] = {32, 2}, [UNICODE_MODE_BSD] = {32, 2}, [UNICODE_MODE_WINCOMPOSE] = {32, 2}, [UNICODE_MODE_EMACS] = {32, 2}},
+    [LATIN_SMALL_LETTER_U_WITH_GRAVE]        = {[UNICODE_MODE_LINUX] = {34, 1}, [UNICODE_MODE_WINDOWS] = {34, 1}, [UNICODE_MODE_BSD] = {34, 1}, [UNICODE_MODE_WINCOMPOSE] = {34, 1}, [UNICODE_MODE_EMACS] = {34, 1}},
+    [LATIN_CAPITAL_LETTER_U_WITH_GRAVE]      = {[UNICODE_MODE_LINUX] = {35, 2}, [UNICODE_MODE_WINDOWS] = {35, 2}, [UNICODE_MODE_BSD] = {35, 2}, [UNICODE_MODE_WINCOMPOSE] = {35, 2}, [UNICODE_MODE_EMACS] = {35, 2}},
+    [EURO_SIGN]                              = {[UNICODE_MODE_LINUX] = {37, 1}, [UNICODE_MODE_WINDOWS] = {37, 1}, [UNICODE_MODE_BSD] = {37, 1}, [UNICODE_MODE_WINCOMPOSE] = {37, 1}, [UNICODE_MODE_EMACS] = {37, 1}},
+    [SUPERSCRIPT_TWO]                        = {[UNICODE_MODE_LINUX] = {38, 1}, [UNICODE_MODE_WINDOWS] = {38, 1}, [UNICODE_MODE_BSD] = {38, 1}, [UNICODE_MODE_WINCOMPOSE] = {38, 1}, [UNICODE_MODE_EMACS] = {38, 1}},
+    [LATIN_SMALL_LETTER_A_WITH_DIAERESIS]    = {[UNICODE_MODE_LINUX] = {39, 2}, [UNICODE_MODE_WINDOWS] = {39, 2}, [UNICODE_MODE_BSD] = {39, 2}, [UNICODE_MODE_WINCOMPOSE] = {39, 2}, [UNICODE_MODE_EMACS] = {39, 2}},
+    [LATIN_CAPITAL_LETTER_A_WITH_DIAERESIS]  = {[UNICODE_MODE_LINUX] = {41, 2}, [UNICODE_MODE_WINDOWS] = {41, 2}, [UNICODE_MODE_BSD] = {41, 2}, [UNICODE_MODE_WINCOMPOSE] = {41, 2}, [UNICODE_MODE_EMACS] = {41, 2}},
+    [LATIN_SMALL_LETTER_E_WITH_DIAERESIS]    = {[UNICODE_MODE_LINUX] = {43, 2}, [UNICODE_MODE_WINDOWS] = {43, 2}, [UNICODE_MODE_BSD] = {43, 2}, [UNICODE_MODE_WINCOMPOSE] = {43, 2}, [UNICODE_MODE_EMACS] = {43, 2}},
+    [LATIN_CAPITAL_LETTER_E_WITH_DIAERESIS]  = {[UNICODE_MODE_LINUX] = {45, 2}, [UNICODE_MODE_WINDOWS] = {45, 2}, [UNICODE_MODE_BSD] = {45, 2}, [UNICODE_MODE_WINCOMPOSE] = {45, 2}, [UNICODE_MODE_EMACS] = {45, 2}},
+    [LATIN_SMALL_LETTER_O_WITH_DIAERESIS]    = {[UNICODE_MODE_LINUX] = {47, 2}, [UNICODE_MODE_WINDOWS] = {47, 2}, [UNICODE_MODE_BSD] = {47, 2}, [UNICODE_MODE_WINCOMPOSE] = {47, 2}, [UNICODE_MODE_EMACS] = {47, 2}},
+    [LATIN_CAPITAL_LETTER_O_WITH_DIAERESIS]  = {[UNICODE_MODE_LINUX] = {49, 2}, [UNICODE_MODE_WINDOWS] = {49, 2}, [UNICODE_MODE_BSD] = {49, 2}, [UNICODE_MODE_WINCOMPOSE] = {49, 2}, [UNICODE_MODE_EMACS] = {49, 2}},
+    [LATIN_SMALL_LETTER_U_WITH_DIAERESIS]    = {[UNICODE_MODE_LINUX] = {51, 2}, [UNICODE_MODE_WINDOWS] = {51, 2}, [UNICODE_MODE_BSD] = {51, 2}, [UNICODE_MODE_WINCOMPOSE] = {51, 2}, [UNICODE_MODE_EMACS] = {51, 2}},
+    [LATIN_CAPITAL_LETTER_U_WITH_DIAERESIS]  = {[UNICODE_MODE_LINUX] = {53, 2}, [UNICODE_MODE_WINDOWS] = {53, 2}, [UNICODE_MODE_BSD] = {53, 2}, [UNICODE_MODE_WINCOMPOSE] = {53, 2}, [UNICODE_MODE_EMACS] = {53, 2}},
+    [LATIN_SMALL_LETTER_Y_WITH_DIAERESIS]    = {[UNICODE_MODE_LINUX] = {55, 2}, [UNICODE_MODE_WINDOWS] = {55, 2}, [UNICODE_MODE_BSD] = {55, 2}, [UNICODE_MODE_WINCOMPOSE] = {55, 2}, [UNICODE_MODE_EMACS] = {55, 2}},
+    [LATIN_CAPITAL_LETTER_Y_WITH_DIAERESIS] = {[UNICODE_MODE_LINUX] = {57, 2}, [UNICODE_MODE_WINDOWS] = {57, 2}, [UNICODE_MODE_BSD] = {57, 2}, [UNICODE_MODE_WINCOMPOSE] = {57, 2}, [UNICODE_MODE_EMACS] = {57, 2}}
 };
 
-const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
-    [Base] = LAYOUT(
-        // clang-format off
+const shift_key_t PROGMEM shift_keys[] = {
+    // Base
+    {FR_4, FR_DLR},
+    {FR_5, FR_PERC},
+    {FR_7, FR_AMPR},
+    {FR_8, FR_ASTR},
+    {FR_9, FR_HASH},
+    {FR_0, FR_AT},
+    {CKC_DK, KC_EXLM},
+    {FR_MINS, FR_QUES},
+    {FR_DOT, FR_COLN},
+    {FR_COMM, FR_SCLN},
+    // Sym
+    {FR_DLR, FR_DLR},
+    {FR_AMPR, FR_AMPR},
+    {FR_LPRN, FR_LPRN},
+    {FR_RPRN, FR_RPRN},
+    {FR_HASH, FR_HASH},
+    {FR_COLN, FR_COLN},
+    {KC_SPC, KC_SPC},
+};
+
+const shift_layer_t PROGMEM shift_layers[LAYER_COUNT] = {
+    [Base] = {0, 10},
+    [Sym]  = {10, 7},
+};
 
+// Only the keys which are not KC_TRNS are stored, in LAYOUT() order, see
+// users/daedric/sparse_keymap.h:
+/*
+[Base] = LAYOUT(
             KC_ESC    ,   Base_EKC_1  ,   Base_EKC_2  ,   Base_EKC_3  ,      FR_4     ,      FR_5     , LT(Fn, KC_ESC),           LT(Fn, KC_ESC),   Base_EKC_6  ,      FR_7     ,      FR_8     ,      FR_9     ,      FR_0     ,     KC_INS    ,
-            KC_TAB    ,      FR_Q     ,      FR_C     ,      FR_O     ,      FR_P     ,      FR_W     ,     KC_DEL    ,              KC_BSPC    ,      FR_J     ,      FR_M     ,      FR_D     ,    OSL(DK)    ,      FR_Y     ,    _______    ,
+            KC_TAB    ,      FR_Q     ,      FR_C     ,      FR_O     ,      FR_P     ,      FR_W     ,     KC_DEL    ,              KC_BSPC    ,      FR_J     ,      FR_M     ,      FR_D     ,     CKC_DK    ,      FR_Y     ,    _______    ,
             KC_GRV    ,      FR_A     ,      FR_S     ,      FR_E     ,      FR_N     ,      FR_F     ,    _______    ,              _______    ,      FR_L     ,      FR_R     ,      FR_T     ,      FR_I     ,    _______    ,    _______    ,
            KC_LSFT    ,      FR_Z     ,      FR_X     ,    FR_MINS    ,      FR_V     ,      FR_B     ,                       FR_DOT    ,      FR_H     ,      FR_G     ,    FR_COMM    ,      FR_K     ,    KC_RSFT    ,
            KC_LCTL    ,    _______    ,    KC_LEFT    ,    KC_RIGHT   ,    KC_LGUI    ,            _______    ,        _______    ,           KC_UP     ,    KC_DOWN    ,    _______    ,    _______    ,    _______    ,
                                MO(Sym)    ,    _______    ,    _______    ,        KC_LALT    ,    KC_ENTER   ,  Base_EKC_SPC
-
-        // clang-format on
-        ),
-    [DK] = LAYOUT(
-        // clang-format off
-
-          _______  ,  DK_EKC_1  ,  DK_EKC_2  ,  DK_EKC_3  ,  DK_EKC_4  ,  DK_EKC_5  ,   _______  ,             _______  ,   _______  ,   _______  ,   FR_SECT  ,  DK_EKC_9  ,   FR_DEG   ,   _______  ,
-          _______  ,  DK_EKC_Q  ,  DK_EKC_C  ,  DK_EKC_O  ,  DK_EKC_P  ,   _______  ,   _______  ,             _______  ,   _______  ,  DK_EKC_M  ,   FR_UNDS  ,  DK_EKC_DK ,  DK_EKC_Y  ,   _______  ,
-          _______  ,  DK_EKC_A  ,  DK_EKC_S  ,  DK_EKC_E  ,  DK_EKC_N  ,  DK_EKC_F  ,   _______  ,             _______  ,   FR_LPRN  ,   FR_RPRN  ,  DK_EKC_T  ,  DK_EKC_I  ,   _______  ,   _______  ,
-          _______  ,  DK_EKC_Z  ,  DK_EKC_X  , DK_EKC_MNS ,  DK_EKC_V  ,  DK_EKC_B  ,                   DK_EKC_DOT ,   _______  ,   _______  , DK_EKC_COMM,   _______  ,   _______  ,
-          _______  ,   _______  ,   _______  ,   _______  ,   _______  ,           _______  ,       _______  ,         _______  ,   _______  ,   _______  ,   _______  ,   _______  ,
-                              _______  ,   _______  ,   _______  ,       _______  ,   _______  , DK_EKC_SPC
-
-        // clang-format on
-        ),
-    [Sym] = LAYOUT(
-        // clang-format off
-
+),
+[Sym] = LAYOUT(
           _______  ,  Sym_EKC_1 ,  Sym_EKC_2 ,  Sym_EKC_3 ,  Sym_EKC_4 ,  Sym_EKC_5 ,   _______  ,             _______  ,  Sym_EKC_6 ,  Sym_EKC_7 ,  Sym_EKC_8 ,  Sym_EKC_9 ,  Sym_EKC_0 ,   _______  ,
           _______  ,  Sym_EKC_Q ,  Sym_EKC_C ,  Sym_EKC_O ,   FR_DLR   ,  Sym_EKC_W ,   _______  ,             _______  ,  Sym_EKC_J ,   FR_AMPR  ,  Sym_EKC_D , Sym_EKC_DK ,  Sym_EKC_Y ,   _______  ,
           _______  ,  Sym_EKC_A ,   FR_LPRN  ,   FR_RPRN  ,  Sym_EKC_N ,  Sym_EKC_F ,   _______  ,             _______  ,  Sym_EKC_L ,  Sym_EKC_R ,  Sym_EKC_T ,  Sym_EKC_I ,   _______  ,   _______  ,
           _______  ,  Sym_EKC_Z ,  Sym_EKC_X , Sym_EKC_MNS,  Sym_EKC_V ,   FR_HASH  ,                   Sym_EKC_DOT,  Sym_EKC_H ,  Sym_EKC_G ,   FR_COLN  ,  Sym_EKC_K ,   _______  ,
           _______  ,   _______  ,   _______  ,   _______  ,   _______  ,           _______  ,       _______  ,         _______  ,   _______  ,   _______  ,   _______  ,   _______  ,
                               _______  ,   _______  ,   _______  ,       _______  ,   _______  ,   KC_SPC
-
-        // clang-format on
-        ),
-    [Fn] = LAYOUT(
-        // clang-format off
-
+),
+[Fn] = LAYOUT(
          KC_F1 ,  KC_F2 ,  KC_F3 ,  KC_F4 ,  KC_F5 ,  KC_F6 , _______,           _______,  KC_F7 ,  KC_F8 ,  KC_F9 , KC_F10 , KC_F11 , KC_F12 ,
         _______, _______, _______, _______, _______, _______, _______,           _______, _______, _______, _______, _______, _______, _______,
         _______, _______, _______, _______, _______, _______, _______,           _______, _______, _______, _______, _______, _______, _______,
         _______, _______, _______, _______, _______, _______,                   _______, _______, _______, _______, _______, _______,
         _______, _______, UC_PREV, UC_NEXT, QK_BOOT,         _______,     _______,       _______, _______, _______, _______, _______,
                             _______, _______, _______,     _______, _______, _______
+),
+*/
+
+const uint8_t PROGMEM keymap_positions[MATRIX_ROWS][MATRIX_COLS] = LAYOUT(
+    // clang-format off
+
+         1,  2,  3,  4,  5,  6,  7,            8,  9, 10, 11, 12, 13, 14,
+        15, 16, 17, 18, 19, 20, 21,           22, 23, 24, 25, 26, 27, 28,
+        29, 30, 31, 32, 33, 34, 35,           36, 37, 38, 39, 40, 41, 42,
+        43, 44, 45, 46, 47, 48,                   49, 50, 51, 52, 53, 54,
+        55, 56, 57, 58, 59,         60,     61,       62, 63, 64, 65, 66,
+                            67, 68, 69,     70, 71, 72
+
+    // clang-format on
+    );
+
+const keymap_layer_t PROGMEM keymap_layers[LAYER_COUNT] = {
+    [Base] = {.bitmap = {0xFF, 0xFF, 0xFF, 0xF7, 0xF3, 0xFC, 0x7F, 0x67, 0xE4}, .rank = {0, 8, 16, 24, 31, 37, 43, 50, 55}, .offset = 0},
+    [Sym]  = {.bitmap = {0x3E, 0x9F, 0xCF, 0xE7, 0xF3, 0xF8, 0x1F, 0x00, 0x80}, .rank = {0, 5, 11, 17, 23, 29, 34, 39, 39}, .offset = 59},
+    [Fn]   = {.bitmap = {0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00}, .rank = {0, 6, 12, 12, 12, 12, 12, 12, 15}, .offset = 99},
+};
+
+// 114 of the 216 keys
+const uint16_t PROGMEM keymap_keycodes[] = {
+    // Base
+    KC_ESC, Base_EKC_1, Base_EKC_2, Base_EKC_3, FR_4, FR_5, LT(Fn, KC_ESC), LT(Fn, KC_ESC), Base_EKC_6, FR_7, FR_8, FR_9, FR_0, KC_INS, KC_TAB, FR_Q, FR_C, FR_O, FR_P, FR_W, KC_DEL, KC_BSPC, FR_J, FR_M, FR_D, CKC_DK, FR_Y, KC_GRV, FR_A, FR_S, FR_E, FR_N, FR_F, FR_L, FR_R, FR_T, FR_I, KC_LSFT, FR_Z, FR_X, FR_MINS, FR_V, FR_B, FR_DOT, FR_H, FR_G, FR_COMM, FR_K, KC_RSFT, KC_LCTL, KC_LEFT, KC_RIGHT, KC_LGUI, KC_UP, KC_DOWN, MO(Sym), KC_LALT, KC_ENTER, Base_EKC_SPC,
+    // Sym
+    Sym_EKC_1, Sym_EKC_2, Sym_EKC_3, Sym_EKC_4, Sym_EKC_5, Sym_EKC_6, Sym_EKC_7, Sym_EKC_8, Sym_EKC_9, Sym_EKC_0, Sym_EKC_Q, Sym_EKC_C, Sym_EKC_O, FR_DLR, Sym_EKC_W, Sym_EKC_J, FR_AMPR, Sym_EKC_D, Sym_EKC_DK, Sym_EKC_Y, Sym_EKC_A, FR_LPRN, FR_RPRN, Sym_EKC_N, Sym_EKC_F, Sym_EKC_L, Sym_EKC_R, Sym_EKC_T, Sym_EKC_I, Sym_EKC_Z, Sym_EKC_X, Sym_EKC_MNS, Sym_EKC_V, FR_HASH, Sym_EKC_DOT, Sym_EKC_H, Sym_EKC_G, FR_COLN, Sym_EKC_K, KC_SPC,
+    // Fn
+    KC_F1, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6, KC_F7, KC_F8, KC_F9, KC_F10, KC_F11, KC_F12, UC_PREV, UC_NEXT, QK_BOOT,
+};
+
+// Unused, QMK needs it but the layers are read through sparse_keymap.c which
+// overrides keymap_layer_count() and keycode_at_keymap_location()
+const uint16_t PROGMEM keymaps[1][MATRIX_ROWS][MATRIX_COLS] = {{{KC_NO}}};
+
+const sequence_entry_t PROGMEM sequence_entries[] = {
+    {FR_Q, UM(LATIN_SMALL_LETTER_A_WITH_CIRCUMFLEX), UM(LATIN_CAPITAL_LETTER_A_WITH_CIRCUMFLEX), SEQUENCE_NONE},
+    {FR_C, FR_CCED, UM(LATIN_CAPITAL_LETTER_C_WITH_CEDILLA), SEQUENCE_NONE},
+    {FR_O, UM(LATIN_SMALL_LIGATURE_OE), UM(LATIN_CAPITAL_LIGATURE_OE), SEQUENCE_NONE},
+    {FR_P, UM(LATIN_SMALL_LETTER_O_WITH_CIRCUMFLEX), UM(LATIN_CAPITAL_LETTER_O_WITH_CIRCUMFLEX), SEQUENCE_NONE},
+    {FR_M, UM(MICRO_SIGN), UM(MICRO_SIGN), SEQUENCE_NONE},
+    {FR_D, FR_UNDS, FR_UNDS, SEQUENCE_NONE},
+    {CKC_DK, UM(COMBINING_DIAERESIS), UM(INVERTED_EXCLAMATION_MARK), 1},
+    {FR_Y, UM(LATIN_SMALL_LETTER_U_WITH_CIRCUMFLEX), UM(LATIN_CAPITAL_LETTER_U_WITH_CIRCUMFLEX), SEQUENCE_NONE},
+    {FR_A, FR_AGRV, UM(LATIN_CAPITAL_LETTER_A_WITH_GRAVE), SEQUENCE_NONE},
+    {FR_S, FR_EACU, UM(LATIN_CAPITAL_LETTER_E_WITH_ACUTE), SEQUENCE_NONE},
+    {FR_E, FR_EGRV, UM(LATIN_CAPITAL_LETTER_E_WITH_GRAVE), SEQUENCE_NONE},
+    {FR_N, UM(LATIN_SMALL_LETTER_E_WITH_CIRCUMFLEX), UM(LATIN_CAPITAL_LETTER_E_WITH_CIRCUMFLEX), SEQUENCE_NONE},
+    {FR_F, UM(LATIN_SMALL_LETTER_N_WITH_TILDE), UM(LATIN_CAPITAL_LETTER_N_WITH_TILDE), SEQUENCE_NONE},
+    {FR_L, FR_LPRN, FR_LPRN, SEQUENCE_NONE},
+    {FR_R, FR_RPRN, FR_RPRN, SEQUENCE_NONE},
+    {FR_T, UM(LATIN_SMALL_LETTER_I_WITH_CIRCUMFLEX), UM(LATIN_CAPITAL_LETTER_I_WITH_CIRCUMFLEX), SEQUENCE_NONE},
+    {FR_I, UM(LATIN_SMALL_LETTER_I_WITH_DIAERESIS), UM(LATIN_CAPITAL_LETTER_I_WITH_DIAERESIS), SEQUENCE_NONE},
+    {FR_Z, UM(LATIN_SMALL_LETTER_AE), UM(LATIN_CAPITAL_LETTER_AE), SEQUENCE_NONE},
+    {FR_X, UM(LATIN_SMALL_LETTER_SHARP_S), UM(LATIN_CAPITAL_LETTER_SHARP_S), SEQUENCE_NONE},
+    {FR_MINS, UM(NON_BREAKING_HYPHEN), UM(INVERTED_QUESTION_MARK), SEQUENCE_NONE},
+    {FR_V, UM(EN_DASH), UM(EN_DASH), SEQUENCE_NONE},
+    {FR_B, UM(EM_DASH), UM(EM_DASH), SEQUENCE_NONE},
+    {FR_DOT, UM(HORIZONTAL_ELLIPSIS), UM(HORIZONTAL_ELLIPSIS), SEQUENCE_NONE},
+    {FR_COMM, UM(MIDDLE_DOT), UM(BULLET), SEQUENCE_NONE},
+    {Base_EKC_1, UM(DOUBLE_LOW_9_QUOTATION_MARK), UM(SINGLE_LOW_9_QUOTATION_MARK), SEQUENCE_NONE},
+    {Base_EKC_2, UM(LEFT_DOUBLE_QUOTATION_MARK), UM(LEFT_SINGLE_QUOTATION_MARK), SEQUENCE_NONE},
+    {Base_EKC_3, UM(RIGHT_DOUBLE_QUOTATION_MARK), UM(RIGHT_SINGLE_QUOTATION_MARK), SEQUENCE_NONE},
+    {FR_4, UM(CENT_SIGN), UM(CENT_SIGN), SEQUENCE_NONE},
+    {FR_5, UM(PER_MILLE_SIGN), UM(PER_MILLE_SIGN), SEQUENCE_NONE},
+    {FR_8, FR_SECT, FR_SECT, SEQUENCE_NONE},
+    {FR_9, UM(PILCROW_SIGN), UM(PILCROW_SIGN), SEQUENCE_NONE},
+    {FR_0, FR_DEG, FR_DEG, SEQUENCE_NONE},
+    {Base_EKC_SPC, UM(RIGHT_SINGLE_QUOTATION_MARK), UM(RIGHT_SINGLE_QUOTATION_MARK), SEQUENCE_NONE},
+    {Sym_EKC_F, FR_EQL, FR_EQL, 2},
+    {FR_A, UM(LATIN_SMALL_LETTER_A_WITH_DIAERESIS), UM(LATIN_CAPITAL_LETTER_A_WITH_DIAERESIS), SEQUENCE_NONE},
+    {FR_E, UM(LATIN_SMALL_LETTER_E_WITH_DIAERESIS), UM(LATIN_CAPITAL_LETTER_E_WITH_DIAERESIS), SEQUENCE_NONE},
+    {FR_I, UM(LATIN_SMALL_LETTER_I_WITH_DIAERESIS), UM(LATIN_CAPITAL_LETTER_I_WITH_DIAERESIS), SEQUENCE_NONE},
+    {FR_O, UM(LATIN_SMALL_LETTER_O_WITH_DIAERESIS), UM(LATIN_CAPITAL_LETTER_O_WITH_DIAERESIS), SEQUENCE_NONE},
+    {FR_Y, UM(LATIN_SMALL_LETTER_Y_WITH_DIAERESIS), UM(LATIN_CAPITAL_LETTER_Y_WITH_DIAERESIS), SEQUENCE_NONE},
+    {Sym_EKC_I, UM(NOT_EQUAL_TO), UM(NOT_EQUAL_TO), SEQUENCE_NONE},
+};
 
-        // clang-format on
-        ),
+const sequence_node_t PROGMEM sequence_nodes[] = {
+    {0, 34},
+    {34, 5},
+    {39, 1},
 };
 
-bool process_record_user(uint16_t keycode, keyrecord_t *record) {
-    const bool key_pressed = record->event.pressed;
-    const bool shifted     = (get_mods() & MOD_MASK_SHIFT) != 0;
-    uint16_t   kc;
-    uint8_t    skc_idx;
-    switch (keycode) {
-        default:
-            return true;
-
-        case CKC_LMOVE_Base:
-            layer_move(Base);
-            return false;
-            break;
-
-        case CKC_LMOVE_DK:
-            layer_move(DK);
-            return false;
-            break;
-
-        case CKC_LMOVE_Sym:
-            layer_move(Sym);
-            return false;
-            break;
-
-        case CKC_LMOVE_Fn:
-            layer_move(Fn);
-            return false;
-            break;
-
-        case Base_EKC_1:
-            kc      = FR_1;
-            skc_idx = EURO_SIGN;
-            break;
-
-        case Base_EKC_2:
-            kc      = FR_2;
-            skc_idx = LEFT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK;
-            break;
-
-        case Base_EKC_3:
-            kc      = FR_3;
-            skc_idx = RIGHT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK;
-            break;
-
-        case Base_EKC_6:
-            kc      = FR_6;
-            skc_idx = CIRCUMFLEX_ACCENT;
-            break;
-
-        case Base_EKC_SPC:
-            kc      = KC_SPC;
-            skc_idx = NARROW_NO_BREAK_SPACE;
-            break;
-
-        case DK_EKC_C:
-            kc      = FR_CCED;
-            skc_idx = LATIN_CAPITAL_LETTER_C_WITH_CEDILLA;
-            break;
-
-        case DK_EKC_A:
-            kc      = FR_AGRV;
-            skc_idx = LATIN_CAPITAL_LETTER_A_WITH_GRAVE;
-            break;
-
-        case DK_EKC_S:
-            kc      = FR_EACU;
-            skc_idx = LATIN_CAPITAL_LETTER_E_WITH_ACUTE;
-            break;
-
-        case DK_EKC_E:
-            kc      = FR_EGRV;
-            skc_idx = LATIN_CAPITAL_LETTER_E_WITH_GRAVE;
-            break;
-
-        case Sym_EKC_C:
-            kc      = FR_LABK;
-            skc_idx = LESS_THAN_OR_EQUAL_TO;
-            break;
-
-        case Sym_EKC_O:
-            kc      = FR_RABK;
-            skc_idx = GREATER_THAN_OR_EQUAL_TO;
-            break;
-
-        case Sym_EKC_W:
-            kc      = FR_PERC;
-            skc_idx = PER_MILLE_SIGN;
-            break;
-
-        case Sym_EKC_J:
-            kc      = FR_AT;
-            skc_idx = COMBINING_RING_ABOVE;
-            break;
-
-        case Sym_EKC_D:
-            kc      = FR_ASTR;
-            skc_idx = MULTIPLICATION_SIGN;
-            break;
-
-        case Sym_EKC_DK:
-            kc      = FR_QUOT;
-            skc_idx = COMBINING_ACUTE_ACCENT;
-            break;
-
-        case Sym_EKC_Y:
-            kc      = FR_GRV;
-            skc_idx = COMBINING_GRAVE_ACCENT;
-            break;
-
-        case Sym_EKC_A:
-            kc      = FR_LCBR;
-            skc_idx = COMBINING_CARON;
-            break;
-
-        case Sym_EKC_N:
-            kc      = FR_RCBR;
-            skc_idx = COMBINING_DOT_ABOVE;
-            break;
-
-        case Sym_EKC_F:
-            kc      = FR_EQL;
-            skc_idx = NOT_EQUAL_TO;
-            break;
-
-        case Sym_EKC_L:
-            kc      = FR_BSLS;
-            skc_idx = COMBINING_LONG_SOLIDUS_OVERLAY;
-            break;
-
-        case Sym_EKC_R:
-            kc      = FR_PLUS;
-            skc_idx = PLUS_SIGN_ABOVE_EQUALS_SIGN;
-            break;
-
-        case Sym_EKC_T:
-            kc      = FR_MINS;
-            skc_idx = COMBINING_MACRON;
-            break;
-
-        case Sym_EKC_I:
-            kc      = FR_SLSH;
-            skc_idx = DIVISION_SIGN;
-            break;
-
-        case Sym_EKC_Z:
-            kc      = FR_TILD;
-            skc_idx = COMBINING_TILDE;
-            break;
-
-        case Sym_EKC_X:
-            kc      = FR_LBRC;
-            skc_idx = COMBINING_COMMA_BELOW;
-            break;
-
-        case Sym_EKC_MNS:
-            kc      = FR_RBRC;
-            skc_idx = COMBINING_OGONEK;
-            break;
-
-        case Sym_EKC_V:
-            kc      = FR_UNDS;
-            skc_idx = EN_DASH;
-            break;
-
-        case Sym_EKC_DOT:
-            kc      = FR_PIPE;
-            skc_idx = BROKEN_BAR;
-            break;
-
-        case Sym_EKC_H:
-            kc      = FR_EXLM;
-            skc_idx = NOT_SIGN;
-            break;
-
-        case Sym_EKC_G:
-            kc      = FR_SCLN;
-            skc_idx = COMBINING_TURNED_COMMA_ABOVE;
-            break;
-
-        case Sym_EKC_K:
-            kc      = FR_QUES;
-            skc_idx = COMBINING_BREVE;
-            break;
-    }
-
-    if (shifted) {
-        if (key_pressed) {
-            uint8_t temp_mod = get_mods();
-            clear_mods();
-            uint32_t skc = unicodemap_get_code_point(skc_idx);
-            register_unicode(skc);
-            set_mods(temp_mod);
-            return false;
-        }
-    } else {
-        if (key_pressed) {
-            register_code16(kc);
-        } else {
-            unregister_code16(kc);
-        }
-    }
-
-    return true;
-}
+#ifdef AUTOCORRECT_ENABLE
+#    include "autocorrect_trie.h"
+
+const uint8_t PROGMEM autocorrect_unicode[UNICODE_MAP_COUNT] = {
+    [LATIN_SMALL_LETTER_A_WITH_CIRCUMFLEX]       = 30 /* â */,
+    [LATIN_CAPITAL_LETTER_A_WITH_CIRCUMFLEX]     = 30 /* â */,
+    [LATIN_CAPITAL_LETTER_C_WITH_CEDILLA]        = 32 /* ç */,
+    [LATIN_SMALL_LIGATURE_OE]                    = 40 /* œ */,
+    [LATIN_CAPITAL_LIGATURE_OE]                  = 40 /* œ */,
+    [LATIN_SMALL_LETTER_O_WITH_CIRCUMFLEX]       = 39 /* ô */,
+    [LATIN_CAPITAL_LETTER_O_WITH_CIRCUMFLEX]     = 39 /* ô */,
+    [PER_MILLE_SIGN]                             = AUTOCORRECT_BOUNDARY /* : */,
+    [INVERTED_EXCLAMATION_MARK]                  = AUTOCORRECT_BOUNDARY /* : */,
+    [LATIN_SMALL_LETTER_U_WITH_CIRCUMFLEX]       = 42 /* û */,
+    [LATIN_CAPITAL_LETTER_U_WITH_CIRCUMFLEX]     = 42 /* û */,
+    [LATIN_CAPITAL_LETTER_A_WITH_GRAVE]          = 29 /* à */,
+    [LATIN_CAPITAL_LETTER_E_WITH_ACUTE]          = 33 /* é */,
+    [LATIN_CAPITAL_LETTER_E_WITH_GRAVE]          = 34 /* è */,
+    [LATIN_SMALL_LETTER_E_WITH_CIRCUMFLEX]       = 35 /* ê */,
+    [LATIN_CAPITAL_LETTER_E_WITH_CIRCUMFLEX]     = 35 /* ê */,
+    [LATIN_SMALL_LETTER_I_WITH_CIRCUMFLEX]       = 37 /* î */,
+    [LATIN_CAPITAL_LETTER_I_WITH_CIRCUMFLEX]     = 37 /* î */,
+    [LATIN_SMALL_LETTER_I_WITH_DIAERESIS]        = 38 /* ï */,
+    [LATIN_CAPITAL_LETTER_I_WITH_DIAERESIS]      = 38 /* ï */,
+    [LATIN_SMALL_LETTER_U_WITH_GRAVE]            = 41 /* ù */,
+    [LATIN_CAPITAL_LETTER_U_WITH_GRAVE]          = 41 /* ù */,
+    [LATIN_SMALL_LETTER_AE]                      = 31 /* æ */,
+    [LATIN_CAPITAL_LETTER_AE]                    = 31 /* æ */,
+    [NON_BREAKING_HYPHEN]                        = AUTOCORRECT_BOUNDARY /* : */,
+    [INVERTED_QUESTION_MARK]                     = AUTOCORRECT_BOUNDARY /* : */,
+    [EN_DASH]                                    = AUTOCORRECT_BOUNDARY /* : */,
+    [EM_DASH]                                    = AUTOCORRECT_BOUNDARY /* : */,
+    [HORIZONTAL_ELLIPSIS]                        = AUTOCORRECT_BOUNDARY /* : */,
+    [MIDDLE_DOT]                                 = AUTOCORRECT_BOUNDARY /* : */,
+    [BULLET]                                     = AUTOCORRECT_BOUNDARY /* : */,
+    [DOUBLE_LOW_9_QUOTATION_MARK]                = AUTOCORRECT_BOUNDARY /* : */,
+    [SINGLE_LOW_9_QUOTATION_MARK]                = AUTOCORRECT_BOUNDARY /* : */,
+    [LEFT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK]  = AUTOCORRECT_BOUNDARY /* : */,
+    [LEFT_DOUBLE_QUOTATION_MARK]                 = AUTOCORRECT_BOUNDARY /* : */,
+    [LEFT_SINGLE_QUOTATION_MARK]                 = AUTOCORRECT_BOUNDARY /* : */,
+    [RIGHT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK] = AUTOCORRECT_BOUNDARY /* : */,
+    [RIGHT_DOUBLE_QUOTATION_MARK]                = AUTOCORRECT_BOUNDARY /* : */,
+    [RIGHT_SINGLE_QUOTATION_MARK]                = 2 /* ' */,
+    [PILCROW_SIGN]                               = AUTOCORRECT_BOUNDARY /* : */,
+    [NARROW_NO_BREAK_SPACE]                      = AUTOCORRECT_BOUNDARY /* : */,
+    [LATIN_SMALL_LETTER_E_WITH_DIAERESIS]        = 36 /* ë */,
+    [LATIN_CAPITAL_LETTER_E_WITH_DIAERESIS]      = 36 /* ë */,
+    [LATIN_SMALL_LETTER_U_WITH_DIAERESIS]        = 43 /* ü */,
+    [LATIN_CAPITAL_LETTER_U_WITH_DIAERESIS]      = 43 /* ü */,
+    [LATIN_SMALL_LETTER_Y_WITH_DIAERESIS]        = 44 /* ÿ */,
+    [LATIN_CAPITAL_LETTER_Y_WITH_DIAERESIS]      = 44 /* ÿ */,
+};
+
+const autocorrect_key_t PROGMEM autocorrect_keys[] = {
+    {FR_QUOT, 2}, // '
+    {FR_A, 3}, // a
+    {FR_B, 4}, // b
+    {FR_C, 5}, // c
+    {FR_D, 6}, // d
+    {FR_E, 7}, // e
+    {FR_F, 8}, // f
+    {FR_G, 9}, // g
+    {FR_H, 10}, // h
+    {FR_I, 11}, // i
+    {FR_J, 12}, // j
+    {FR_K, 13}, // k
+    {FR_L, 14}, // l
+    {FR_M, 15}, // m
+    {FR_N, 16}, // n
+    {FR_O, 17}, // o
+    {FR_P, 18}, // p
+    {FR_Q, 19}, // q
+    {FR_R, 20}, // r
+    {FR_S, 21}, // s
+    {FR_T, 22}, // t
+    {FR_U, 23}, // u
+    {FR_V, 24}, // v
+    {FR_W, 25}, // w
+    {FR_X, 26}, // x
+    {FR_Y, 27}, // y
+    {FR_Z, 28}, // z
+    {FR_AGRV, 29}, // à
+    {FR_CCED, 32}, // ç
+    {FR_EACU, 33}, // é
+    {FR_EGRV, 34}, // è
+    {FR_1, AUTOCORRECT_BOUNDARY}, // :
+    {FR_2, AUTOCORRECT_BOUNDARY}, // :
+    {FR_3, AUTOCORRECT_BOUNDARY}, // :
+    {FR_4, AUTOCORRECT_BOUNDARY}, // :
+    {FR_5, AUTOCORRECT_BOUNDARY}, // :
+    {FR_6, AUTOCORRECT_BOUNDARY}, // :
+    {FR_7, AUTOCORRECT_BOUNDARY}, // :
+    {FR_8, AUTOCORRECT_BOUNDARY}, // :
+    {FR_9, AUTOCORRECT_BOUNDARY}, // :
+    {FR_0, AUTOCORRECT_BOUNDARY}, // :
+    {FR_MINS, AUTOCORRECT_BOUNDARY}, // :
+    {FR_DOT, AUTOCORRECT_BOUNDARY}, // :
+    {FR_COMM, AUTOCORRECT_BOUNDARY}, // :
+    {KC_SPC, AUTOCORRECT_BOUNDARY}, // :
+    {FR_LABK, AUTOCORRECT_BOUNDARY}, // :
+    {FR_RABK, AUTOCORRECT_BOUNDARY}, // :
+    {FR_DLR, AUTOCORRECT_BOUNDARY}, // :
+    {FR_PERC, AUTOCORRECT_BOUNDARY}, // :
+    {FR_AT, AUTOCORRECT_BOUNDARY}, // :
+    {FR_AMPR, AUTOCORRECT_BOUNDARY}, // :
+    {FR_ASTR, AUTOCORRECT_BOUNDARY}, // :
+    {FR_GRV, AUTOCORRECT_BOUNDARY}, // :
+    {FR_LCBR, AUTOCORRECT_BOUNDARY}, // :
+    {FR_LPRN, AUTOCORRECT_BOUNDARY}, // :
+    {FR_RPRN, AUTOCORRECT_BOUNDARY}, // :
+    {FR_RCBR, AUTOCORRECT_BOUNDARY}, // :
+    {FR_EQL, AUTOCORRECT_BOUNDARY}, // :
+    {FR_BSLS, AUTOCORRECT_BOUNDARY}, // :
+    {FR_PLUS, AUTOCORRECT_BOUNDARY}, // :
+    {FR_SLSH, AUTOCORRECT_BOUNDARY}, // :
+    {FR_TILD, AUTOCORRECT_BOUNDARY}, // :
+    {FR_LBRC, AUTOCORRECT_BOUNDARY}, // :
+    {FR_RBRC, AUTOCORRECT_BOUNDARY}, // :
+    {FR_UNDS, AUTOCORRECT_BOUNDARY}, // :
+    {FR_HASH, AUTOCORRECT_BOUNDARY}, // :
+    {FR_PIPE, AUTOCORRECT_BOUNDARY}, // :
+    {FR_EXLM, AUTOCORRECT_BOUNDARY}, // :
+    {FR_SCLN, AUTOCORRECT_BOUNDARY}, // :
+    {FR_COLN, AUTOCORRECT_BOUNDARY}, // :
+    {FR_QUES, AUTOCORRECT_BOUNDARY}, // :
+    {FR_SECT, AUTOCORRECT_BOUNDARY}, // :
+    {KC_ENT, AUTOCORRECT_BOUNDARY}, // :
+    {KC_TAB, AUTOCORRECT_BOUNDARY}, // :
+    {CKC_DK, AUTOCORRECT_BOUNDARY}, // :
+    {KC_NO, AUTOCORRECT_NONE},
+};
+
+const uint16_t PROGMEM autocorrect_keycodes[] = {
+    [AUTOCORRECT_BOUNDARY] = KC_SPC,
+    [2]                    = FR_QUOT /* ' */,
+    [3]                    = FR_A /* a */,
+    [4]                    = FR_B /* b */,
+    [5]                    = FR_C /* c */,
+    [6]                    = FR_D /* d */,
+    [7]                    = FR_E /* e */,
+    [8]                    = FR_F /* f */,
+    [9]                    = FR_G /* g */,
+    [10]                   = FR_H /* h */,
+    [11]                   = FR_I /* i */,
+    [12]                   = FR_J /* j */,
+    [13]                   = FR_K /* k */,
+    [14]                   = FR_L /* l */,
+    [15]                   = FR_M /* m */,
+    [16]                   = FR_N /* n */,
+    [17]                   = FR_O /* o */,
+    [18]                   = FR_P /* p */,
+    [19]                   = FR_Q /* q */,
+    [20]                   = FR_R /* r */,
+    [21]                   = FR_S /* s */,
+    [22]                   = FR_T /* t */,
+    [23]                   = FR_U /* u */,
+    [24]                   = FR_V /* v */,
+    [25]                   = FR_W /* w */,
+    [26]                   = FR_X /* x */,
+    [27]                   = FR_Y /* y */,
+    [28]                   = FR_Z /* z */,
+    [29]                   = FR_AGRV /* à */,
+    [30]                   = UM(LATIN_SMALL_LETTER_A_WITH_CIRCUMFLEX) /* â */,
+    [31]                   = UM(LATIN_SMALL_LETTER_AE) /* æ */,
+    [32]                   = FR_CCED /* ç */,
+    [33]                   = FR_EACU /* é */,
+    [34]                   = FR_EGRV /* è */,
+    [35]                   = UM(LATIN_SMALL_LETTER_E_WITH_CIRCUMFLEX) /* ê */,
+    [36]                   = UM(LATIN_SMALL_LETTER_E_WITH_DIAERESIS) /* ë */,
+    [37]                   = UM(LATIN_SMALL_LETTER_I_WITH_CIRCUMFLEX) /* î */,
+    [38]                   = UM(LATIN_SMALL_LETTER_I_WITH_DIAERESIS) /* ï */,
+    [39]                   = UM(LATIN_SMALL_LETTER_O_WITH_CIRCUMFLEX) /* ô */,
+    [40]                   = UM(LATIN_SMALL_LIGATURE_OE) /* œ */,
+    [41]                   = UM(LATIN_SMALL_LETTER_U_WITH_GRAVE) /* ù */,
+    [42]                   = UM(LATIN_SMALL_LETTER_U_WITH_CIRCUMFLEX) /* û */,
+    [43]                   = UM(LATIN_SMALL_LETTER_U_WITH_DIAERESIS) /* ü */,
+    [44]                   = UM(LATIN_SMALL_LETTER_Y_WITH_DIAERESIS) /* ÿ */,
+};
+
+const uint8_t PROGMEM autocorrect_layer_tries[LAYER_COUNT] = {
+    [Base] = 0,
+    [Sym]  = AUTOCORRECT_NO_TRIE,
+    [Fn]   = AUTOCORRECT_NO_TRIE,
+};
+#endif
+
+const custom_key_t PROGMEM custom_keys[CUSTOM_KEY_COUNT] = {
+    [CKC_LMOVE_Base - KEYMAP_SAFE_RANGE] = {TO(Base), 0},
+    [CKC_LMOVE_Sym - KEYMAP_SAFE_RANGE]  = {TO(Sym), 0},
+    [CKC_LMOVE_Fn - KEYMAP_SAFE_RANGE]   = {TO(Fn), 0},
+    [Base_EKC_1 - KEYMAP_SAFE_RANGE]     = {FR_1, EURO_SIGN},
+    [Base_EKC_2 - KEYMAP_SAFE_RANGE]     = {FR_2, LEFT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK},
+    [Base_EKC_3 - KEYMAP_SAFE_RANGE]     = {FR_3, RIGHT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK},
+    [Base_EKC_6 - KEYMAP_SAFE_RANGE]     = {FR_6, CIRCUMFLEX_ACCENT},
+    [Base_EKC_SPC - KEYMAP_SAFE_RANGE]   = {KC_SPC, NARROW_NO_BREAK_SPACE},
+    [Sym_EKC_C - KEYMAP_SAFE_RANGE]      = {FR_LABK, LESS_THAN_OR_EQUAL_TO},
+    [Sym_EKC_O - KEYMAP_SAFE_RANGE]      = {FR_RABK, GREATER_THAN_OR_EQUAL_TO},
+    [Sym_EKC_W - KEYMAP_SAFE_RANGE]      = {FR_PERC, PER_MILLE_SIGN},
+    [Sym_EKC_J - KEYMAP_SAFE_RANGE]      = {FR_AT, COMBINING_RING_ABOVE},
+    [Sym_EKC_D - KEYMAP_SAFE_RANGE]      = {FR_ASTR, MULTIPLICATION_SIGN},
+    [Sym_EKC_DK - KEYMAP_SAFE_RANGE]     = {FR_QUOT, COMBINING_ACUTE_ACCENT},
+    [Sym_EKC_Y - KEYMAP_SAFE_RANGE]      = {FR_GRV, COMBINING_GRAVE_ACCENT},
+    [Sym_EKC_A - KEYMAP_SAFE_RANGE]      = {FR_LCBR, COMBINING_CARON},
+    [Sym_EKC_N - KEYMAP_SAFE_RANGE]      = {FR_RCBR, COMBINING_DOT_ABOVE},
+    [Sym_EKC_F - KEYMAP_SAFE_RANGE]      = {FR_EQL, NOT_EQUAL_TO},
+    [Sym_EKC_L - KEYMAP_SAFE_RANGE]      = {FR_BSLS, COMBINING_LONG_SOLIDUS_OVERLAY},
+    [Sym_EKC_R - KEYMAP_SAFE_RANGE]      = {FR_PLUS, PLUS_SIGN_ABOVE_EQUALS_SIGN},
+    [Sym_EKC_T - KEYMAP_SAFE_RANGE]      = {FR_MINS, COMBINING_MACRON},
+    [Sym_EKC_I - KEYMAP_SAFE_RANGE]      = {FR_SLSH, DIVISION_SIGN},
+    [Sym_EKC_Z - KEYMAP_SAFE_RANGE]      = {FR_TILD, COMBINING_TILDE},
+    [Sym_EKC_X - KEYMAP_SAFE_RANGE]      = {FR_LBRC, COMBINING_COMMA_BELOW},
+    [Sym_EKC_MNS - KEYMAP_SAFE_RANGE]    = {FR_RBRC, COMBINING_OGONEK},
+    [Sym_EKC_V - KEYMAP_SAFE_RANGE]      = {FR_UNDS, EN_DASH},
+    [Sym_EKC_DOT - KEYMAP_SAFE_RANGE]    = {FR_PIPE, BROKEN_BAR},
+    [Sym_EKC_H - KEYMAP_SAFE_RANGE]      = {FR_EXLM, NOT_SIGN},
+    [Sym_EKC_G - KEYMAP_SAFE_RANGE]      = {FR_SCLN, COMBINING_TURNED_COMMA_ABOVE},
+    [Sym_EKC_K - KEYMAP_SAFE_RANGE]      = {FR_QUES, COMBINING_BREVE},
+};
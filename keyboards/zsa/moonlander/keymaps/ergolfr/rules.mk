@@ -1,4 +1,8 @@
 LTO_ENABLE = yes
 UNICODE_COMMON = yes
-UNICODEMAP_ENABLE = yes
-KEY_OVERRIDE_ENABLE = yes
+# The keymap has its own 16 bits unicode_map, typed by the unicode queue
+UNICODEMAP_ENABLE = no
+
+# The runtime of the generated keymap, without the LEDs of the daedric ones
+USER_NAME := daedric
+DAEDRIC_RUNTIME_ONLY = yes
@@ -0,0 +1,58 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Generated by scripts/gen_autocorrect.py from users/daedric/autocorrect
+
+#pragma once
+
+// Base (10 entries):
+//   :thier       -> their
+//   fitler       -> filter
+//   lenght       -> length
+//   ouput        -> output
+//   widht        -> width
+//   bandwith     -> bandwidth
+//   apss         -> pass
+//   :déja        -> déjà
+//   évenement    -> événement
+//   interressant -> intéressant
+
+// Qwerty (7 entries):
+//   :thier   -> their
+//   fitler   -> filter
+//   lenght   -> length
+//   ouput    -> output
+//   widht    -> width
+//   bandwith -> bandwidth
+//   apss     -> pass
+
+#define AUTOCORRECT_MIN_LENGTH 4 // "apss"
+#define AUTOCORRECT_MAX_LENGTH 12 // "interressant"
+#define DICTIONARY_SIZE 263
+#define AUTOCORRECT_TRIES 2
+
+// Start of every trie in autocorrect_data, then its end: Base, Qwerty
+static const uint16_t autocorrect_tries[AUTOCORRECT_TRIES + 1] = {0, 160, 263};
+
+// QMK's autocorrect walks the first one, when it is not turned off
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
+    // Base
+    0x43, 0x10, 0x00, 0x0A, 0x18, 0x00, 0x14, 0x25, 0x00, 0x15, 0x41, 0x00, 0x16, 0x4B, 0x00, 0x00,
+    0x0C, 0x21, 0x06, 0x01, 0x00, 0x80, 0x1D, 0x00, 0x16, 0x0B, 0x19, 0x06, 0x10, 0x03, 0x04, 0x00,
+    0x81, 0x06, 0x16, 0x0A, 0x00, 0x07, 0x00, 0x4B, 0x2E, 0x00, 0x0E, 0x37, 0x00, 0x00, 0x0A, 0x16,
+    0x01, 0x00, 0x82, 0x07, 0x0B, 0x14, 0x00, 0x16, 0x0B, 0x08, 0x00, 0x83, 0x0E, 0x16, 0x07, 0x14,
+    0x00, 0x15, 0x12, 0x03, 0x00, 0x83, 0x12, 0x03, 0x15, 0x15, 0x00, 0x4A, 0x55, 0x00, 0x10, 0x6B,
+    0x00, 0x17, 0x96, 0x00, 0x00, 0x46, 0x5C, 0x00, 0x09, 0x63, 0x00, 0x00, 0x0B, 0x19, 0x00, 0x81,
+    0x16, 0x0A, 0x00, 0x10, 0x07, 0x0E, 0x00, 0x81, 0x16, 0x0A, 0x00, 0x43, 0x72, 0x00, 0x07, 0x86,
+    0x00, 0x00, 0x15, 0x15, 0x07, 0x14, 0x14, 0x07, 0x16, 0x10, 0x0B, 0x00, 0x88, 0x21, 0x14, 0x07,
+    0x15, 0x15, 0x03, 0x10, 0x16, 0x00, 0x0F, 0x07, 0x10, 0x07, 0x18, 0x21, 0x00, 0x86, 0x21, 0x10,
+    0x07, 0x0F, 0x07, 0x10, 0x16, 0x00, 0x12, 0x17, 0x11, 0x00, 0x82, 0x16, 0x12, 0x17, 0x16, 0x00,
+    // Qwerty
+    0x4A, 0x0D, 0x00, 0x14, 0x1A, 0x00, 0x15, 0x36, 0x00, 0x16, 0x40, 0x00, 0x00, 0x16, 0x0B, 0x19,
+    0x06, 0x10, 0x03, 0x04, 0x00, 0x81, 0x06, 0x16, 0x0A, 0x00, 0x07, 0x00, 0x4B, 0x23, 0x00, 0x0E,
+    0x2C, 0x00, 0x00, 0x0A, 0x16, 0x01, 0x00, 0x82, 0x07, 0x0B, 0x14, 0x00, 0x16, 0x0B, 0x08, 0x00,
+    0x83, 0x0E, 0x16, 0x07, 0x14, 0x00, 0x15, 0x12, 0x03, 0x00, 0x83, 0x12, 0x03, 0x15, 0x15, 0x00,
+    0x4A, 0x47, 0x00, 0x17, 0x5D, 0x00, 0x00, 0x46, 0x4E, 0x00, 0x09, 0x55, 0x00, 0x00, 0x0B, 0x19,
+    0x00, 0x81, 0x16, 0x0A, 0x00, 0x10, 0x07, 0x0E, 0x00, 0x81, 0x16, 0x0A, 0x00, 0x12, 0x17, 0x11,
+    0x00, 0x82, 0x16, 0x12, 0x17, 0x16, 0x00,
+};
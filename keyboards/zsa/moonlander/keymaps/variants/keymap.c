@@ -0,0 +1,1164 @@
+#include QMK_KEYBOARD_H
+
+#include <stdint.h>
+
+#include "keycodes.h"
+#include "version.h"
+
+#include "keymap_french.h"
+#include "variants.h"
+
+#include "custom_keys.h"
+#include "hosts.h"
+#include "sequences.h"
+#include "sparse_keymap.h"
+#include "unicode_queue.h"
+
+enum layers {
+    DaedricBase,
+    Daedric34Base,
+    StdBase,
+    DaedricQwerty,
+    DaedricSym,
+    DaedricMedia,
+    DaedricFn,
+    Daedric34Qwerty,
+    Daedric34Sym,
+    Daedric34SymQwerty,
+    Daedric34Nav,
+    Daedric34Media,
+    Daedric34Fn,
+    StdSym,
+    StdFn,
+};
+
+// LAYER_COUNT, the width of layer_state_t and the sizes of the tables read
+// by users/daedric come from layers.h
+_Static_assert(StdFn + 1 == LAYER_COUNT, "layers.h is out of date");
+_Static_assert(LAYER_COUNT <= sizeof(layer_state_t) * 8, "layer_state_t is too small for the layers");
+
+// Keymaps of the firmware, see users/daedric/variants.h
+#ifdef COMBO_ENABLE
+// Right outer key of the top row and inner left thumb key, switch to the next
+// keymap
+const uint16_t PROGMEM variant_combo[] = {KC_INS, LGUI(KC_R), COMBO_END};
+combo_t key_combos[]                   = {COMBO_ACTION(variant_combo)};
+
+void process_combo_event(uint16_t combo_index, bool pressed) {
+    // The only combo
+    (void)combo_index;
+    if (pressed) {
+        variant_next();
+    }
+}
+#endif
+
+enum custom_keycodes {
+    CKC_LMOVE_DaedricBase = KEYMAP_SAFE_RANGE,
+    CKC_LMOVE_Daedric34Base,
+    CKC_LMOVE_StdBase,
+    CKC_LMOVE_DaedricQwerty,
+    CKC_LMOVE_DaedricSym,
+    CKC_LMOVE_DaedricMedia,
+    CKC_LMOVE_DaedricFn,
+    CKC_LMOVE_Daedric34Qwerty,
+    CKC_LMOVE_Daedric34Sym,
+    CKC_LMOVE_Daedric34SymQwerty,
+    CKC_LMOVE_Daedric34Nav,
+    CKC_LMOVE_Daedric34Media,
+    CKC_LMOVE_Daedric34Fn,
+    CKC_LMOVE_StdSym,
+    CKC_LMOVE_StdFn,
+    Base_EKC_1,
+    Base_EKC_2,
+    Base_EKC_3,
+    Base_EKC_SPC,
+    Sym_EKC_Q,
+    Sym_EKC_C,
+    Sym_EKC_O,
+    Sym_EKC_W,
+    Sym_EKC_J,
+    Sym_EKC_D,
+    Sym_EKC_DK,
+    Sym_EKC_Y,
+    Sym_EKC_A,
+    Sym_EKC_N,
+    Sym_EKC_F,
+    Sym_EKC_L,
+    Sym_EKC_R,
+    Sym_EKC_T,
+    Sym_EKC_I,
+    Sym_EKC_U,
+    Sym_EKC_Z,
+    Sym_EKC_X,
+    Sym_EKC_MNS,
+    Sym_EKC_V,
+    Sym_EKC_DOT,
+    Sym_EKC_H,
+    Sym_EKC_G,
+    Sym_EKC_K,
+};
+
+_Static_assert(Sym_EKC_K - KEYMAP_SAFE_RANGE + 1 == CUSTOM_KEY_COUNT, "layers.h is out of date");
+
+#define Sym_EKC_1 UP(SUBSCRIPT_ONE, SUPERSCRIPT_ONE)
+#define Sym_EKC_2 UP(SUBSCRIPT_TWO, SUPERSCRIPT_TWO)
+#define Sym_EKC_3 UP(SUBSCRIPT_THREE, SUPERSCRIPT_THREE)
+#define Sym_EKC_4 UP(SUBSCRIPT_FOUR, SUPERSCRIPT_FOUR)
+#define Sym_EKC_5 UP(SUBSCRIPT_FIVE, SUPERSCRIPT_FIVE)
+#define Sym_EKC_6 UP(SUBSCRIPT_SIX, SUPERSCRIPT_SIX)
+#define Sym_EKC_7 UP(SUBSCRIPT_SEVEN, SUPERSCRIPT_SEVEN)
+#define Sym_EKC_8 UP(SUBSCRIPT_EIGHT, SUPERSCRIPT_EIGHT)
+#define Sym_EKC_9 UP(SUBSCRIPT_NINE, SUPERSCRIPT_NINE)
+#define Sym_EKC_0 UP(SUBSCRIPT_ZERO, SUPERSCRIPT_ZERO)
+
+enum unicode_names {
+    COMBINING_CIRCUMFLEX_ACCENT,
+    LATIN_SMALL_LETTER_A_WITH_CIRCUMFLEX,
+    LATIN_CAPITAL_LETTER_A_WITH_CIRCUMFLEX,
+    LESS_THAN_OR_EQUAL_TO,
+    LATIN_SMALL_LETTER_C_WITH_CEDILLA,
+    LATIN_CAPITAL_LETTER_C_WITH_CEDILLA,
+    GREATER_THAN_OR_EQUAL_TO,
+    LATIN_SMALL_LIGATURE_OE,
+    LATIN_CAPITAL_LIGATURE_OE,
+    LATIN_SMALL_LETTER_O_WITH_CIRCUMFLEX,
+    LATIN_CAPITAL_LETTER_O_WITH_CIRCUMFLEX,
+    PER_MILLE_SIGN,
+    COMBINING_RING_ABOVE,
+    MICRO_SIGN,
+    MULTIPLICATION_SIGN,
+    COMBINING_ACUTE_ACCENT,
+    COMBINING_DIAERESIS,
+    INVERTED_EXCLAMATION_MARK,
+    COMBINING_GRAVE_ACCENT,
+    LATIN_SMALL_LETTER_U_WITH_CIRCUMFLEX,
+    LATIN_CAPITAL_LETTER_U_WITH_CIRCUMFLEX,
+    COMBINING_CARON,
+    LATIN_SMALL_LETTER_A_WITH_GRAVE,
+    LATIN_CAPITAL_LETTER_A_WITH_GRAVE,
+    LATIN_SMALL_LETTER_E_WITH_ACUTE,
+    LATIN_CAPITAL_LETTER_E_WITH_ACUTE,
+    LATIN_SMALL_LETTER_E_WITH_GRAVE,
+    LATIN_CAPITAL_LETTER_E_WITH_GRAVE,
+    COMBINING_DOT_ABOVE,
+    LATIN_SMALL_LETTER_E_WITH_CIRCUMFLEX,
+    LATIN_CAPITAL_LETTER_E_WITH_CIRCUMFLEX,
+    NOT_EQUAL_TO,
+    LATIN_SMALL_LETTER_N_WITH_TILDE,
+    LATIN_CAPITAL_LETTER_N_WITH_TILDE,
+    COMBINING_LONG_SOLIDUS_OVERLAY,
+    PLUS_SIGN_ABOVE_EQUALS_SIGN,
+    COMBINING_MACRON,
+    LATIN_SMALL_LETTER_I_WITH_CIRCUMFLEX,
+    LATIN_CAPITAL_LETTER_I_WITH_CIRCUMFLEX,
+    DIVISION_SIGN,
+    LATIN_SMALL_LETTER_I_WITH_DIAERESIS,
+    LATIN_CAPITAL_LETTER_I_WITH_DIAERESIS,
+    COMBINING_DOUBLE_ACUTE_ACCENT,
+    LATIN_SMALL_LETTER_U_WITH_GRAVE,
+    LATIN_CAPITAL_LETTER_U_WITH_GRAVE,
+    COMBINING_TILDE,
+    LATIN_SMALL_LETTER_AE,
+    LATIN_CAPITAL_LETTER_AE,
+    COMBINING_COMMA_BELOW,
+    LATIN_SMALL_LETTER_SHARP_S,
+    LATIN_CAPITAL_LETTER_SHARP_S,
+    COMBINING_OGONEK,
+    NON_BREAKING_HYPHEN,
+    INVERTED_QUESTION_MARK,
+    EN_DASH,
+    EM_DASH,
+    BROKEN_BAR,
+    HORIZONTAL_ELLIPSIS,
+    NOT_SIGN,
+    COMBINING_TURNED_COMMA_ABOVE,
+    MIDDLE_DOT,
+    BULLET,
+    COMBINING_BREVE,
+    EURO_SIGN,
+    SUBSCRIPT_ONE,
+    SUPERSCRIPT_ONE,
+    DOUBLE_LOW_9_QUOTATION_MARK,
+    SINGLE_LOW_9_QUOTATION_MARK,
+    LEFT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK,
+    SUBSCRIPT_TWO,
+    SUPERSCRIPT_TWO,
+    LEFT_DOUBLE_QUOTATION_MARK,
+    LEFT_SINGLE_QUOTATION_MARK,
+    RIGHT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK,
+    SUBSCRIPT_THREE,
+    SUPERSCRIPT_THREE,
+    RIGHT_DOUBLE_QUOTATION_MARK,
+    RIGHT_SINGLE_QUOTATION_MARK,
+    SUBSCRIPT_FOUR,
+    SUPERSCRIPT_FOUR,
+    CENT_SIGN,
+    SUBSCRIPT_FIVE,
+    SUPERSCRIPT_FIVE,
+    SUBSCRIPT_SIX,
+    SUPERSCRIPT_SIX,
+    SUBSCRIPT_SEVEN,
+    SUPERSCRIPT_SEVEN,
+    SUBSCRIPT_EIGHT,
+    SUPERSCRIPT_EIGHT,
+    SECTION_SIGN,
+    SUBSCRIPT_NINE,
+    SUPERSCRIPT_NINE,
+    PILCROW_SIGN,
+    SUBSCRIPT_ZERO,
+    SUPERSCRIPT_ZERO,
+    DEGREE_SIGN,
+    NARROW_NO_BREAK_SPACE,
+    LATIN_SMALL_LETTER_A_WITH_DIAERESIS,
+    LATIN_CAPITAL_LETTER_A_WITH_DIAERESIS,
+    LATIN_SMALL_LETTER_E_WITH_DIAERESIS,
+    LATIN_CAPITAL_LETTER_E_WITH_DIAERESIS,
+    LATIN_SMALL_LETTER_O_WITH_DIAERESIS,
+    LATIN_CAPITAL_LETTER_O_WITH_DIAERESIS,
+    LATIN_SMALL_LETTER_U_WITH_DIAERESIS,
+    LATIN_CAPITAL_LETTER_U_WITH_DIAERESIS,
+    LATIN_SMALL_LETTER_Y_WITH_DIAERESIS,
+    LATIN_CAPITAL_LETTER_Y_WITH_DIAERESIS,
+};
+
+_Static_assert(LATIN_CAPITAL_LETTER_Y_WITH_DIAERESIS + 1 == UNICODE_MAP_COUNT, "layers.h is out of date");
+
+const uint16_t PROGMEM unicode_map[] = {
+    [COMBINING_CIRCUMFLEX_ACCENT]                = 0x0302 /* ̂ */,
+    [LATIN_SMALL_LETTER_A_WITH_CIRCUMFLEX]       = 0x00e2 /* â */,
+    [LATIN_CAPITAL_LETTER_A_WITH_CIRCUMFLEX]     = 0x00c2 /* Â */,
+    [LESS_THAN_OR_EQUAL_TO]                      = 0x2264 /* ≤ */,
+    [LATIN_SMALL_LETTER_C_WITH_CEDILLA]          = 0x00e7 /* ç */,
+    [LATIN_CAPITAL_LETTER_C_WITH_CEDILLA]        = 0x00c7 /* Ç */,
+    [GREATER_THAN_OR_EQUAL_TO]                   = 0x2265 /* ≥ */,
+    [LATIN_SMALL_LIGATURE_OE]                    = 0x0153 /* œ */,
+    [LATIN_CAPITAL_LIGATURE_OE]                  = 0x0152 /* Œ */,
+    [LATIN_SMALL_LETTER_O_WITH_CIRCUMFLEX]       = 0x00f4 /* ô */,
+    [LATIN_CAPITAL_LETTER_O_WITH_CIRCUMFLEX]     = 0x00d4 /* Ô */,
+    [PER_MILLE_SIGN]                             = 0x2030 /* ‰ */,
+    [COMBINING_RING_ABOVE]                       = 0x030a /* ̊ */,
+    [MICRO_SIGN]                                 = 0x00b5 /* µ */,
+    [MULTIPLICATION_SIGN]                        = 0x00d7 /* × */,
+    [COMBINING_ACUTE_ACCENT]                     = 0x0301 /* ́ */,
+    [COMBINING_DIAERESIS]                        = 0x0308 /* ̈ */,
+    [INVERTED_EXCLAMATION_MARK]                  = 0x00a1 /* ¡ */,
+    [COMBINING_GRAVE_ACCENT]                     = 0x0300 /* ̀ */,
+    [LATIN_SMALL_LETTER_U_WITH_CIRCUMFLEX]       = 0x00fb /* û */,
+    [LATIN_CAPITAL_LETTER_U_WITH_CIRCUMFLEX]     = 0x00db /* Û */,
+    [COMBINING_CARON]                            = 0x030c /* ̌ */,
+    [LATIN_SMALL_LETTER_A_WITH_GRAVE]            = 0x00e0 /* à */,
+    [LATIN_CAPITAL_LETTER_A_WITH_GRAVE]          = 0x00c0 /* À */,
+    [LATIN_SMALL_LETTER_E_WITH_ACUTE]            = 0x00e9 /* é */,
+    [LATIN_CAPITAL_LETTER_E_WITH_ACUTE]          = 0x00c9 /* É */,
+    [LATIN_SMALL_LETTER_E_WITH_GRAVE]            = 0x00e8 /* è */,
+    [LATIN_CAPITAL_LETTER_E_WITH_GRAVE]          = 0x00c8 /* È */,
+    [COMBINING_DOT_ABOVE]                        = 0x0307 /* ̇ */,
+    [LATIN_SMALL_LETTER_E_WITH_CIRCUMFLEX]       = 0x00ea /* ê */,
+    [LATIN_CAPITAL_LETTER_E_WITH_CIRCUMFLEX]     = 0x00ca /* Ê */,
+    [NOT_EQUAL_TO]                               = 0x2260 /* ≠ */,
+    [LATIN_SMALL_LETTER_N_WITH_TILDE]            = 0x00f1 /* ñ */,
+    [LATIN_CAPITAL_LETTER_N_WITH_TILDE]          = 0x00d1 /* Ñ */,
+    [COMBINING_LONG_SOLIDUS_OVERLAY]             = 0x0338 /* ̸ */,
+    [PLUS_SIGN_ABOVE_EQUALS_SIGN]                = 0x2a72 /* ⩲ */,
+    [COMBINING_MACRON]                           = 0x0304 /* ̄ */,
+    [LATIN_SMALL_LETTER_I_WITH_CIRCUMFLEX]       = 0x00ee /* î */,
+    [LATIN_CAPITAL_LETTER_I_WITH_CIRCUMFLEX]     = 0x00ce /* Î */,
+    [DIVISION_SIGN]                              = 0x00f7 /* ÷ */,
+    [LATIN_SMALL_LETTER_I_WITH_DIAERESIS]        = 0x00ef /* ï */,
+    [LATIN_CAPITAL_LETTER_I_WITH_DIAERESIS]      = 0x00cf /* Ï */,
+    [COMBINING_DOUBLE_ACUTE_ACCENT]              = 0x030b /* ̋ */,
+    [LATIN_SMALL_LETTER_U_WITH_GRAVE]            = 0x00f9 /* ù */,
+    [LATIN_CAPITAL_LETTER_U_WITH_GRAVE]          = 0x00d9 /* Ù */,
+    [COMBINING_TILDE]                            = 0x0303 /* ̃ */,
+    [LATIN_SMALL_LETTER_AE]                      = 0x00e6 /* æ */,
+    [LATIN_CAPITAL_LETTER_AE]                    = 0x00c6 /* Æ */,
+    [COMBINING_COMMA_BELOW]                      = 0x0326 /* ̦ */,
+    [LATIN_SMALL_LETTER_SHARP_S]                 = 0x00df /* ß */,
+    [LATIN_CAPITAL_LETTER_SHARP_S]               = 0x1e9e /* ẞ */,
+    [COMBINING_OGONEK]                           = 0x0328 /* ̨ */,
+    [NON_BREAKING_HYPHEN]                        = 0x2011 /* ‑ */,
+    [INVERTED_QUESTION_MARK]                     = 0x00bf /* ¿ */,
+    [EN_DASH]                                    = 0x2013 /* – */,
+    [EM_DASH]                                    = 0x2014 /* — */,
+    [BROKEN_BAR]                                 = 0x00a6 /* ¦ */,
+    [HORIZONTAL_ELLIPSIS]                        = 0x2026 /* … */,
+    [NOT_SIGN]                                   = 0x00ac /* ¬ */,
+    [COMBINING_TURNED_COMMA_ABOVE]               = 0x0312 /* ̒ */,
+    [MIDDLE_DOT]                                 = 0x00b7 /* · */,
+    [BULLET]                                     = 0x2022 /* • */,
+    [COMBINING_BREVE]                            = 0x0306 /* ̆ */,
+    [EURO_SIGN]                                  = 0x20ac /* € */,
+    [SUBSCRIPT_ONE]                              = 0x2081 /* ₁ */,
+    [SUPERSCRIPT_ONE]                            = 0x00b9 /* ¹ */,
+    [DOUBLE_LOW_9_QUOTATION_MARK]                = 0x201e /* „ */,
+    [SINGLE_LOW_9_QUOTATION_MARK]                = 0x201a /* ‚ */,
+    [LEFT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK]  = 0x00ab /* « */,
+    [SUBSCRIPT_TWO]                              = 0x2082 /* ₂ */,
+    [SUPERSCRIPT_TWO]                            = 0x00b2 /* ² */,
+    [LEFT_DOUBLE_QUOTATION_MARK]                 = 0x201c /* “ */,
+    [LEFT_SINGLE_QUOTATION_MARK]                 = 0x2018 /* ‘ */,
+    [RIGHT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK] = 0x00bb /* » */,
+    [SUBSCRIPT_THREE]                            = 0x2083 /* ₃ */,
+    [SUPERSCRIPT_THREE]                          = 0x00b3 /* ³ */,
+    [RIGHT_DOUBLE_QUOTATION_MARK]                = 0x201d /* ” */,
+    [RIGHT_SINGLE_QUOTATION_MARK]                = 0x2019 /* ’ */,
+    [SUBSCRIPT_FOUR]                             = 0x2084 /* ₄ */,
+    [SUPERSCRIPT_FOUR]                           = 0x2074 /* ⁴ */,
+    [CENT_SIGN]                                  = 0x00a2 /* ¢ */,
+    [SUBSCRIPT_FIVE]                             = 0x2085 /* ₅ */,
+    [SUPERSCRIPT_FIVE]                           = 0x2075 /* ⁵ */,
+    [SUBSCRIPT_SIX]                              = 0x2086 /* ₆ */,
+    [SUPERSCRIPT_SIX]                            = 0x2076 /* ⁶ */,
+    [SUBSCRIPT_SEVEN]                            = 0x2087 /* ₇ */,
+    [SUPERSCRIPT_SEVEN]                          = 0x2077 /* ⁷ */,
+    [SUBSCRIPT_EIGHT]                            = 0x2088 /* ₈ */,
+    [SUPERSCRIPT_EIGHT]                          = 0x2078 /* ⁸ */,
+    [SECTION_SIGN]                               = 0x00a7 /* § */,
+    [SUBSCRIPT_NINE]                             = 0x2089 /* ₉ */,
+    [SUPERSCRIPT_NINE]                           = 0x2079 /* ⁹ */,
+    [PILCROW_SIGN]                               = 0x00b6 /* ¶ */,
+    [SUBSCRIPT_ZERO]                             = 0x2080 /* ₀ */,
+    [SUPERSCRIPT_ZERO]                           = 0x2070 /* ⁰ */,
+    [DEGREE_SIGN]                                = 0x00b0 /* ° */,
+    [NARROW_NO_BREAK_SPACE]                      = 0x202f /*   */,
+    [LATIN_SMALL_LETTER_A_WITH_DIAERESIS]        = 0x00e4 /* ä */,
+    [LATIN_CAPITAL_LETTER_A_WITH_DIAERESIS]      = 0x00c4 /* Ä */,
+    [LATIN_SMALL_LETTER_E_WITH_DIAERESIS]        = 0x00eb /* ë */,
+    [LATIN_CAPITAL_LETTER_E_WITH_DIAERESIS]      = 0x00cb /* Ë */,
+    [LATIN_SMALL_LETTER_O_WITH_DIAERESIS]        = 0x00f6 /* ö */,
+    [LATIN_CAPITAL_LETTER_O_WITH_DIAERESIS]      = 0x00d6 /* Ö */,
+    [LATIN_SMALL_LETTER_U_WITH_DIAERESIS]        = 0x00fc /* ü */,
+    [LATIN_CAPITAL_LETTER_U_WITH_DIAERESIS]      = 0x00dc /* Ü */,
+    [LATIN_SMALL_LETTER_Y_WITH_DIAERESIS]        = 0x00ff /* ÿ */,
+    [LATIN_CAPITAL_LETTER_Y_WITH_DIAERESIS]      = 0x0178 /* Ÿ */,
+};
+
+const uint16_t PROGMEM unicode_route_keys[] = {
+    LALT(KC_I), KC_A,          // â
+    KC_CIRC, KC_A,             // â
+    LALT(KC_I), S(KC_A),       // Â
+    KC_CIRC, S(KC_A),          // Â
+    LALT(KC_COMM),             // ≤
+    KC_LABK, KC_EQL,           // ≤
+    LALT(KC_C),                // ç
+    KC_COMM, KC_C,             // ç
+    LSA(KC_C),                 // Ç
+    KC_COMM, S(KC_C),          // Ç
+    LALT(KC_DOT),              // ≥
+    KC_RABK, KC_EQL,           // ≥
+    LALT(KC_Q),                // œ
+    KC_O, KC_E,                // œ
+    LSA(KC_Q),                 // Œ
+    S(KC_O), S(KC_E),          // Œ
+    LALT(KC_I), KC_O,          // ô
+    KC_CIRC, KC_O,             // ô
+    LALT(KC_I), S(KC_O),       // Ô
+    KC_CIRC, S(KC_O),          // Ô
+    LSA(KC_R),                 // ‰
+    KC_PERC, KC_O,             // ‰
+    LALT(KC_M),                // µ
+    KC_M, KC_U,                // µ
+    KC_X, KC_X,                // ×
+    KC_EXLM, KC_EXLM,          // ¡
+    LALT(KC_I), KC_U,          // û
+    KC_CIRC, KC_U,             // û
+    LALT(KC_I), S(KC_U),       // Û
+    KC_CIRC, S(KC_U),          // Û
+    LALT(KC_GRV), KC_A,        // à
+    KC_GRV, KC_A,              // à
+    LALT(KC_GRV), S(KC_A),     // À
+    KC_GRV, S(KC_A),           // À
+    LALT(KC_E), KC_E,          // é
+    KC_QUOT, KC_E,             // é
+    LALT(KC_E), S(KC_E),       // É
+    KC_QUOT, S(KC_E),          // É
+    LALT(KC_GRV), KC_E,        // è
+    KC_GRV, KC_E,              // è
+    LALT(KC_GRV), S(KC_E),     // È
+    KC_GRV, S(KC_E),           // È
+    LALT(KC_I), KC_E,          // ê
+    KC_CIRC, KC_E,             // ê
+    LALT(KC_I), S(KC_E),       // Ê
+    KC_CIRC, S(KC_E),          // Ê
+    LALT(KC_EQL),              // ≠
+    KC_SLSH, KC_EQL,           // ≠
+    LALT(KC_N), KC_N,          // ñ
+    KC_TILD, KC_N,             // ñ
+    LALT(KC_N), S(KC_N),       // Ñ
+    KC_TILD, S(KC_N),          // Ñ
+    LALT(KC_I), KC_I,          // î
+    KC_CIRC, KC_I,             // î
+    LALT(KC_I), S(KC_I),       // Î
+    KC_CIRC, S(KC_I),          // Î
+    LALT(KC_SLSH),             // ÷
+    KC_COLN, KC_MINS,          // ÷
+    LALT(KC_U), KC_I,          // ï
+    KC_DQUO, KC_I,             // ï
+    LALT(KC_U), S(KC_I),       // Ï
+    KC_DQUO, S(KC_I),          // Ï
+    LALT(KC_GRV), KC_U,        // ù
+    KC_GRV, KC_U,              // ù
+    LALT(KC_GRV), S(KC_U),     // Ù
+    KC_GRV, S(KC_U),           // Ù
+    LALT(KC_QUOT),             // æ
+    KC_A, KC_E,                // æ
+    LSA(KC_QUOT),              // Æ
+    S(KC_A), S(KC_E),          // Æ
+    LALT(KC_S),                // ß
+    KC_S, KC_S,                // ß
+    S(KC_S), S(KC_S),          // ẞ
+    LSA(KC_SLSH),              // ¿
+    KC_QUES, KC_QUES,          // ¿
+    LALT(KC_MINS),             // –
+    KC_MINS, KC_MINS, KC_DOT,  // –
+    LSA(KC_MINS),              // —
+    KC_MINS, KC_MINS, KC_MINS, // —
+    KC_EXLM, KC_CIRC,          // ¦
+    LALT(KC_SCLN),             // …
+    KC_DOT, KC_DOT,            // …
+    LALT(KC_L),                // ¬
+    KC_COMM, KC_MINS,          // ¬
+    KC_DOT, KC_MINS,           // ·
+    KC_DOT, KC_EQL,            // •
+    KC_EQL, KC_E,              // €
+    KC_UNDS, KC_1,             // ₁
+    KC_CIRC, KC_1,             // ¹
+    LSA(KC_W),                 // „
+    KC_COMM, KC_DQUO,          // „
+    KC_COMM, KC_QUOT,          // ‚
+    LALT(KC_BSLS),             // «
+    KC_LABK, KC_LABK,          // «
+    KC_UNDS, KC_2,             // ₂
+    KC_CIRC, KC_2,             // ²
+    LALT(KC_LBRC),             // “
+    KC_LABK, KC_DQUO,          // “
+    LALT(KC_RBRC),             // ‘
+    KC_LABK, KC_QUOT,          // ‘
+    LSA(KC_BSLS),              // »
+    KC_RABK, KC_RABK,          // »
+    KC_UNDS, KC_3,             // ₃
+    KC_CIRC, KC_3,             // ³
+    LSA(KC_LBRC),              // ”
+    KC_RABK, KC_DQUO,          // ”
+    LSA(KC_RBRC),              // ’
+    KC_RABK, KC_QUOT,          // ’
+    KC_UNDS, KC_4,             // ₄
+    KC_CIRC, KC_4,             // ⁴
+    KC_C, KC_SLSH,             // ¢
+    KC_UNDS, KC_5,             // ₅
+    KC_CIRC, KC_5,             // ⁵
+    KC_UNDS, KC_6,             // ₆
+    KC_CIRC, KC_6,             // ⁶
+    KC_UNDS, KC_7,             // ₇
+    KC_CIRC, KC_7,             // ⁷
+    KC_UNDS, KC_8,             // ₈
+    KC_CIRC, KC_8,             // ⁸
+    KC_S, KC_O,                // §
+    KC_UNDS, KC_9,             // ₉
+    KC_CIRC, KC_9,             // ⁹
+    S(KC_P), KC_EXLM,          // ¶
+    KC_UNDS, KC_0,             // ₀
+    KC_CIRC, KC_0,             // ⁰
+    KC_O, KC_O,                // °
+    LALT(KC_U), KC_A,          // ä
+    KC_DQUO, KC_A,             // ä
+    LALT(KC_U), S(KC_A),       // Ä
+    KC_DQUO, S(KC_A),          // Ä
+    LALT(KC_U), KC_E,          // ë
+    KC_DQUO, KC_E,             // ë
+    LALT(KC_U), S(KC_E),       // Ë
+    KC_DQUO, S(KC_E),          // Ë
+    LALT(KC_U), KC_O,          // ö
+    KC_DQUO, KC_O,             // ö
+    LALT(KC_U), S(KC_O),       // Ö
+    KC_DQUO, S(KC_O),          // Ö
+    LALT(KC_U), KC_U,          // ü
+    KC_DQUO, KC_U,             // ü
+    LALT(KC_U), S(KC_U),       // Ü
+    KC_DQUO, S(KC_U),          // Ü
+    LALT(KC_U), KC_Y,          // ÿ
+    KC_DQUO, KC_Y,             // ÿ
+    LALT(KC_U), S(KC_Y),       // Ÿ
+    KC_DQUO, S(KC_Y),          // Ÿ
+};
+
+const unicode_route_t PROGMEM unicode_routes[UNICODE_ROUTE_COUNT][UNICODE_MODE_COUNT] = {
+    [LATIN_SMALL_LETTER_A_WITH_CIRCUMFLEX]       = {[UNICODE_MODE_MACOS] = {0, 2}, [UNICODE_MODE_LINUX] = {2, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {2, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_A_WITH_CIRCUMFLEX]     = {[UNICODE_MODE_MACOS] = {4, 2}, [UNICODE_MODE_LINUX] = {6, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {6, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LESS_THAN_OR_EQUAL_TO]                      = {[UNICODE_MODE_MACOS] = {8, 1}, [UNICODE_MODE_LINUX] = {9, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {9, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_C_WITH_CEDILLA]          = {[UNICODE_MODE_MACOS] = {11, 1}, [UNICODE_MODE_LINUX] = {12, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {12, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_C_WITH_CEDILLA]        = {[UNICODE_MODE_MACOS] = {14, 1}, [UNICODE_MODE_LINUX] = {15, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {15, 2 | UNICODE_ROUTE_COMPOSE}},
+    [GREATER_THAN_OR_EQUAL_TO]                   = {[UNICODE_MODE_MACOS] = {17, 1}, [UNICODE_MODE_LINUX] = {18, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {18, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LIGATURE_OE]                    = {[UNICODE_MODE_MACOS] = {20, 1}, [UNICODE_MODE_LINUX] = {21, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {21, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LIGATURE_OE]                  = {[UNICODE_MODE_MACOS] = {23, 1}, [UNICODE_MODE_LINUX] = {24, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {24, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_O_WITH_CIRCUMFLEX]       = {[UNICODE_MODE_MACOS] = {26, 2}, [UNICODE_MODE_LINUX] = {28, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {28, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_O_WITH_CIRCUMFLEX]     = {[UNICODE_MODE_MACOS] = {30, 2}, [UNICODE_MODE_LINUX] = {32, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {32, 2 | UNICODE_ROUTE_COMPOSE}},
+    [PER_MILLE_SIGN]                             = {[UNICODE_MODE_MACOS] = {34, 1}, [UNICODE_MODE_LINUX] = {35, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {35, 2 | UNICODE_ROUTE_COMPOSE}},
+    [MICRO_SIGN]                                 = {[UNICODE_MODE_MACOS] = {37, 1}, [UNICODE_MODE_LINUX] = {38, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {38, 2 | UNICODE_ROUTE_COMPOSE}},
+    [MULTIPLICATION_SIGN]                        = {[UNICODE_MODE_LINUX] = {40, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {40, 2 | UNICODE_ROUTE_COMPOSE}},
+    [INVERTED_EXCLAMATION_MARK]                  = {[UNICODE_MODE_LINUX] = {42, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {42, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_U_WITH_CIRCUMFLEX]       = {[UNICODE_MODE_MACOS] = {44, 2}, [UNICODE_MODE_LINUX] = {46, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {46, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_U_WITH_CIRCUMFLEX]     = {[UNICODE_MODE_MACOS] = {48, 2}, [UNICODE_MODE_LINUX] = {50, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {50, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_A_WITH_GRAVE]            = {[UNICODE_MODE_MACOS] = {52, 2}, [UNICODE_MODE_LINUX] = {54, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {54, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_A_WITH_GRAVE]          = {[UNICODE_MODE_MACOS] = {56, 2}, [UNICODE_MODE_LINUX] = {58, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {58, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_E_WITH_ACUTE]            = {[UNICODE_MODE_MACOS] = {60, 2}, [UNICODE_MODE_LINUX] = {62, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {62, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_E_WITH_ACUTE]          = {[UNICODE_MODE_MACOS] = {64, 2}, [UNICODE_MODE_LINUX] = {66, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {66, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_E_WITH_GRAVE]            = {[UNICODE_MODE_MACOS] = {68, 2}, [UNICODE_MODE_LINUX] = {70, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {70, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_E_WITH_GRAVE]          = {[UNICODE_MODE_MACOS] = {72, 2}, [UNICODE_MODE_LINUX] = {74, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {74, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_E_WITH_CIRCUMFLEX]       = {[UNICODE_MODE_MACOS] = {76, 2}, [UNICODE_MODE_LINUX] = {78, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {78, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_E_WITH_CIRCUMFLEX]     = {[UNICODE_MODE_MACOS] = {80, 2}, [UNICODE_MODE_LINUX] = {82, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {82, 2 | UNICODE_ROUTE_COMPOSE}},
+    [NOT_EQUAL_TO]                               = {[UNICODE_MODE_MACOS] = {84, 1}, [UNICODE_MODE_LINUX] = {85, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {85, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_N_WITH_TILDE]            = {[UNICODE_MODE_MACOS] = {87, 2}, [UNICODE_MODE_LINUX] = {89, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {89, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_N_WITH_TILDE]          = {[UNICODE_MODE_MACOS] = {91, 2}, [UNICODE_MODE_LINUX] = {93, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {93, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_I_WITH_CIRCUMFLEX]       = {[UNICODE_MODE_MACOS] = {95, 2}, [UNICODE_MODE_LINUX] = {97, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {97, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_I_WITH_CIRCUMFLEX]     = {[UNICODE_MODE_MACOS] = {99, 2}, [UNICODE_MODE_LINUX] = {101, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {101, 2 | UNICODE_ROUTE_COMPOSE}},
+    [DIVISION_SIGN]                              = {[UNICODE_MODE_MACOS] = {103, 1}, [UNICODE_MODE_LINUX] = {104, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {104, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_I_WITH_DIAERESIS]        = {[UNICODE_MODE_MACOS] = {106, 2}, [UNICODE_MODE_LINUX] = {108, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {108, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_I_WITH_DIAERESIS]      = {[UNICODE_MODE_MACOS] = {110, 2}, [UNICODE_MODE_LINUX] = {112, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {112, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_U_WITH_GRAVE]            = {[UNICODE_MODE_MACOS] = {114, 2}, [UNICODE_MODE_LINUX] = {116, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {116, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_U_WITH_GRAVE]          = {[UNICODE_MODE_MACOS] = {118, 2}, [UNICODE_MODE_LINUX] = {120, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {120, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_AE]                      = {[UNICODE_MODE_MACOS] = {122, 1}, [UNICODE_MODE_LINUX] = {123, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {123, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_AE]                    = {[UNICODE_MODE_MACOS] = {125, 1}, [UNICODE_MODE_LINUX] = {126, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {126, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_SHARP_S]                 = {[UNICODE_MODE_MACOS] = {128, 1}, [UNICODE_MODE_LINUX] = {129, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {129, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_SHARP_S]               = {[UNICODE_MODE_LINUX] = {131, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {131, 2 | UNICODE_ROUTE_COMPOSE}},
+    [INVERTED_QUESTION_MARK]                     = {[UNICODE_MODE_MACOS] = {133, 1}, [UNICODE_MODE_LINUX] = {134, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {134, 2 | UNICODE_ROUTE_COMPOSE}},
+    [EN_DASH]                                    = {[UNICODE_MODE_MACOS] = {136, 1}, [UNICODE_MODE_LINUX] = {137, 3 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {137, 3 | UNICODE_ROUTE_COMPOSE}},
+    [EM_DASH]                                    = {[UNICODE_MODE_MACOS] = {140, 1}, [UNICODE_MODE_LINUX] = {141, 3 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {141, 3 | UNICODE_ROUTE_COMPOSE}},
+    [BROKEN_BAR]                                 = {[UNICODE_MODE_LINUX] = {144, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {144, 2 | UNICODE_ROUTE_COMPOSE}},
+    [HORIZONTAL_ELLIPSIS]                        = {[UNICODE_MODE_MACOS] = {146, 1}, [UNICODE_MODE_LINUX] = {147, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {147, 2 | UNICODE_ROUTE_COMPOSE}},
+    [NOT_SIGN]                                   = {[UNICODE_MODE_MACOS] = {149, 1}, [UNICODE_MODE_LINUX] = {150, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {150, 2 | UNICODE_ROUTE_COMPOSE}},
+    [MIDDLE_DOT]                                 = {[UNICODE_MODE_LINUX] = {152, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {152, 2 | UNICODE_ROUTE_COMPOSE}},
+    [BULLET]                                     = {[UNICODE_MODE_LINUX] = {154, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {154, 2 | UNICODE_ROUTE_COMPOSE}},
+    [EURO_SIGN]                                  = {[UNICODE_MODE_LINUX] = {156, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {156, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUBSCRIPT_ONE]                              = {[UNICODE_MODE_LINUX] = {158, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {158, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUPERSCRIPT_ONE]                            = {[UNICODE_MODE_LINUX] = {160, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {160, 2 | UNICODE_ROUTE_COMPOSE}},
+    [DOUBLE_LOW_9_QUOTATION_MARK]                = {[UNICODE_MODE_MACOS] = {162, 1}, [UNICODE_MODE_LINUX] = {163, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {163, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SINGLE_LOW_9_QUOTATION_MARK]                = {[UNICODE_MODE_LINUX] = {165, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {165, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LEFT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK]  = {[UNICODE_MODE_MACOS] = {167, 1}, [UNICODE_MODE_LINUX] = {168, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {168, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUBSCRIPT_TWO]                              = {[UNICODE_MODE_LINUX] = {170, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {170, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUPERSCRIPT_TWO]                            = {[UNICODE_MODE_LINUX] = {172, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {172, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LEFT_DOUBLE_QUOTATION_MARK]                 = {[UNICODE_MODE_MACOS] = {174, 1}, [UNICODE_MODE_LINUX] = {175, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {175, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LEFT_SINGLE_QUOTATION_MARK]                 = {[UNICODE_MODE_MACOS] = {177, 1}, [UNICODE_MODE_LINUX] = {178, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {178, 2 | UNICODE_ROUTE_COMPOSE}},
+    [RIGHT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK] = {[UNICODE_MODE_MACOS] = {180, 1}, [UNICODE_MODE_LINUX] = {181, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {181, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUBSCRIPT_THREE]                            = {[UNICODE_MODE_LINUX] = {183, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {183, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUPERSCRIPT_THREE]                          = {[UNICODE_MODE_LINUX] = {185, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {185, 2 | UNICODE_ROUTE_COMPOSE}},
+    [RIGHT_DOUBLE_QUOTATION_MARK]                = {[UNICODE_MODE_MACOS] = {187, 1}, [UNICODE_MODE_LINUX] = {188, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {188, 2 | UNICODE_ROUTE_COMPOSE}},
+    [RIGHT_SINGLE_QUOTATION_MARK]                = {[UNICODE_MODE_MACOS] = {190, 1}, [UNICODE_MODE_LINUX] = {191, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {191, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUBSCRIPT_FOUR]                             = {[UNICODE_MODE_LINUX] = {193, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {193, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUPERSCRIPT_FOUR]                           = {[UNICODE_MODE_LINUX] = {195, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {195, 2 | UNICODE_ROUTE_COMPOSE}},
+    [CENT_SIGN]                                  = {[UNICODE_MODE_LINUX] = {197, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {197, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUBSCRIPT_FIVE]                             = {[UNICODE_MODE_LINUX] = {199, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {199, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUPERSCRIPT_FIVE]                           = {[UNICODE_MODE_LINUX] = {201, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {201, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUBSCRIPT_SIX]                              = {[UNICODE_MODE_LINUX] = {203, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {203, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUPERSCRIPT_SIX]                            = {[UNICODE_MODE_LINUX] = {205, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {205, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUBSCRIPT_SEVEN]                            = {[UNICODE_MODE_LINUX] = {207, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {207, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUPERSCRIPT_SEVEN]                          = {[UNICODE_MODE_LINUX] = {209, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {209, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUBSCRIPT_EIGHT]                            = {[UNICODE_MODE_LINUX] = {211, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {211, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUPERSCRIPT_EIGHT]                          = {[UNICODE_MODE_LINUX] = {213, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {213, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SECTION_SIGN]                               = {[UNICODE_MODE_LINUX] = {215, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {215, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUBSCRIPT_NINE]                             = {[UNICODE_MODE_LINUX] = {217, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {217, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUPERSCRIPT_NINE]                           = {[UNICODE_MODE_LINUX] = {219, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {219, 2 | UNICODE_ROUTE_COMPOSE}},
+    [PILCROW_SIGN]                               = {[UNICODE_MODE_LINUX] = {221, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {221, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUBSCRIPT_ZERO]                             = {[UNICODE_MODE_LINUX] = {223, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {223, 2 | UNICODE_ROUTE_COMPOSE}},
+    [SUPERSCRIPT_ZERO]                           = {[UNICODE_MODE_LINUX] = {225, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {225, 2 | UNICODE_ROUTE_COMPOSE}},
+    [DEGREE_SIGN]                                = {[UNICODE_MODE_LINUX] = {227, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {227, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_A_WITH_DIAERESIS]        = {[UNICODE_MODE_MACOS] = {229, 2}, [UNICODE_MODE_LINUX] = {231, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {231, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_A_WITH_DIAERESIS]      = {[UNICODE_MODE_MACOS] = {233, 2}, [UNICODE_MODE_LINUX] = {235, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {235, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_E_WITH_DIAERESIS]        = {[UNICODE_MODE_MACOS] = {237, 2}, [UNICODE_MODE_LINUX] = {239, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {239, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_E_WITH_DIAERESIS]      = {[UNICODE_MODE_MACOS] = {241, 2}, [UNICODE_MODE_LINUX] = {243, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {243, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_O_WITH_DIAERESIS]        = {[UNICODE_MODE_MACOS] = {245, 2}, [UNICODE_MODE_LINUX] = {247, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {247, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_O_WITH_DIAERESIS]      = {[UNICODE_MODE_MACOS] = {249, 2}, [UNICODE_MODE_LINUX] = {251, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {251, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_U_WITH_DIAERESIS]        = {[UNICODE_MODE_MACOS] = {253, 2}, [UNICODE_MODE_LINUX] = {255, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {255, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_U_WITH_DIAERESIS]      = {[UNICODE_MODE_MACOS] = {257, 2}, [UNICODE_MODE_LINUX] = {259, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {259, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_SMALL_LETTER_Y_WITH_DIAERESIS]        = {[UNICODE_MODE_MACOS] = {261, 2}, [UNICODE_MODE_LINUX] = {263, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {263, 2 | UNICODE_ROUTE_COMPOSE}},
+    [LATIN_CAPITAL_LETTER_Y_WITH_DIAERESIS] = {[UNICODE_MODE_MACOS] = {265, 2}, [UNICODE_MODE_LINUX] = {267, 2 | UNICODE_ROUTE_COMPOSE}, [UNICODE_MODE_WINCOMPOSE] = {267, 2 | UNICODE_ROUTE_COMPOSE}}
+};
+
+const uint16_t PROGMEM host_keys[HOST_COUNT - 1][HOST_KEY_LAST - HOST_KEY_FIRST + 1][2] = {
+    // fr
+    {
+        [KC_A - HOST_KEY_FIRST]    = {FR_A, S(FR_A)},
+        [KC_B - HOST_KEY_FIRST]    = {FR_B, S(FR_B)},
+        [KC_C - HOST_KEY_FIRST]    = {FR_C, S(FR_C)},
+        [KC_D - HOST_KEY_FIRST]    = {FR_D, S(FR_D)},
+        [KC_E - HOST_KEY_FIRST]    = {FR_E, S(FR_E)},
+        [KC_F - HOST_KEY_FIRST]    = {FR_F, S(FR_F)},
+        [KC_G - HOST_KEY_FIRST]    = {FR_G, S(FR_G)},
+        [KC_H - HOST_KEY_FIRST]    = {FR_H, S(FR_H)},
+        [KC_I - HOST_KEY_FIRST]    = {FR_I, S(FR_I)},
+        [KC_J - HOST_KEY_FIRST]    = {FR_J, S(FR_J)},
+        [KC_K - HOST_KEY_FIRST]    = {FR_K, S(FR_K)},
+        [KC_L - HOST_KEY_FIRST]    = {FR_L, S(FR_L)},
+        [KC_M - HOST_KEY_FIRST]    = {FR_M, S(FR_M)},
+        [KC_N - HOST_KEY_FIRST]    = {FR_N, S(FR_N)},
+        [KC_O - HOST_KEY_FIRST]    = {FR_O, S(FR_O)},
+        [KC_P - HOST_KEY_FIRST]    = {FR_P, S(FR_P)},
+        [KC_Q - HOST_KEY_FIRST]    = {FR_Q, S(FR_Q)},
+        [KC_R - HOST_KEY_FIRST]    = {FR_R, S(FR_R)},
+        [KC_S - HOST_KEY_FIRST]    = {FR_S, S(FR_S)},
+        [KC_T - HOST_KEY_FIRST]    = {FR_T, S(FR_T)},
+        [KC_U - HOST_KEY_FIRST]    = {FR_U, S(FR_U)},
+        [KC_V - HOST_KEY_FIRST]    = {FR_V, S(FR_V)},
+        [KC_W - HOST_KEY_FIRST]    = {FR_W, S(FR_W)},
+        [KC_X - HOST_KEY_FIRST]    = {FR_X, S(FR_X)},
+        [KC_Y - HOST_KEY_FIRST]    = {FR_Y, S(FR_Y)},
+        [KC_Z - HOST_KEY_FIRST]    = {FR_Z, S(FR_Z)},
+        [KC_1 - HOST_KEY_FIRST]    = {FR_1, FR_EXLM},
+        [KC_2 - HOST_KEY_FIRST]    = {FR_2, FR_AT},
+        [KC_3 - HOST_KEY_FIRST]    = {FR_3, FR_HASH},
+        [KC_4 - HOST_KEY_FIRST]    = {FR_4, FR_DLR},
+        [KC_5 - HOST_KEY_FIRST]    = {FR_5, FR_PERC},
+        [KC_6 - HOST_KEY_FIRST]    = {FR_6, FR_CIRC},
+        [KC_7 - HOST_KEY_FIRST]    = {FR_7, FR_AMPR},
+        [KC_8 - HOST_KEY_FIRST]    = {FR_8, FR_ASTR},
+        [KC_9 - HOST_KEY_FIRST]    = {FR_9, FR_LPRN},
+        [KC_0 - HOST_KEY_FIRST]    = {FR_0, FR_RPRN},
+        [KC_MINS - HOST_KEY_FIRST] = {FR_MINS, FR_UNDS},
+        [KC_EQL - HOST_KEY_FIRST]  = {FR_EQL, FR_PLUS},
+        [KC_LBRC - HOST_KEY_FIRST] = {FR_LBRC, FR_LCBR},
+        [KC_RBRC - HOST_KEY_FIRST] = {FR_RBRC, FR_RCBR},
+        [KC_BSLS - HOST_KEY_FIRST] = {FR_BSLS, FR_PIPE},
+        [KC_SCLN - HOST_KEY_FIRST] = {FR_SCLN, FR_COLN},
+        [KC_QUOT - HOST_KEY_FIRST] = {FR_QUOT, FR_DQUO},
+        [KC_GRV - HOST_KEY_FIRST]  = {FR_GRV, FR_TILD},
+        [KC_COMM - HOST_KEY_FIRST] = {FR_COMM, FR_LABK},
+        [KC_DOT - HOST_KEY_FIRST]  = {FR_DOT, FR_RABK},
+        [KC_SLSH - HOST_KEY_FIRST] = {FR_SLSH, FR_QUES},
+    },
+};
+
+const shift_key_t PROGMEM shift_keys[] = {
+    // DaedricBase
+    {KC_4, KC_DLR},
+    {KC_5, KC_PERC},
+    {KC_6, KC_CIRC},
+    {KC_7, KC_AMPR},
+    {KC_8, KC_ASTR},
+    {KC_9, KC_HASH},
+    {KC_0, KC_AT},
+    {CKC_DK, KC_EXLM},
+    {KC_MINS, KC_QUES},
+    {KC_DOT, KC_COLN},
+    {KC_COMM, KC_SCLN},
+    // DaedricSym
+    {KC_DLR, KC_DLR},
+    {KC_AMPR, KC_AMPR},
+    {KC_LPRN, KC_LPRN},
+    {KC_RPRN, KC_RPRN},
+    {KC_HASH, KC_HASH},
+    {KC_COLN, KC_COLN},
+    {KC_SPC, KC_SPC},
+    // Daedric34Base
+    {CKC_DK, KC_EXLM},
+    {KC_MINS, KC_QUES},
+    {KC_DOT, KC_COLN},
+    {KC_COMM, KC_SCLN},
+    // Daedric34Sym
+    {KC_DLR, KC_DLR},
+    {KC_AMPR, KC_AMPR},
+    {KC_LPRN, KC_LPRN},
+    {KC_RPRN, KC_RPRN},
+    {KC_HASH, KC_HASH},
+    {KC_COLN, KC_COLN},
+};
+
+const shift_layer_t PROGMEM shift_layers[LAYER_COUNT] = {
+    [DaedricBase]   = {0, 11},
+    [DaedricSym]    = {11, 7},
+    [Daedric34Base] = {18, 4},
+    [Daedric34Sym]  = {22, 6},
+    [StdBase]       = {0, 11},
+    [StdSym]        = {11, 7},
+};
+
+// Only the keys which are not KC_TRNS are stored, in LAYOUT() order, see
+// users/daedric/sparse_keymap.h:
+/*
+[DaedricBase] = LAYOUT(
+                KC_ESC         ,       Base_EKC_1       ,       Base_EKC_2       ,       Base_EKC_3       ,          KC_4          ,          KC_5          ,  LT(DaedricFn, KC_ESC) ,            LT(DaedricFn, KC_ESC) ,          KC_6          ,          KC_7          ,          KC_8          ,          KC_9          ,          KC_0          ,         KC_INS         ,
+                KC_TAB         ,          KC_Q          ,          KC_C          ,          KC_O          ,          KC_P          ,          KC_W          ,         KC_DEL         ,                   KC_BSPC        ,          KC_J          ,          KC_M          ,          KC_D          ,         CKC_DK         ,          KC_Y          ,         _______        ,
+                KC_GRV         ,          KC_A          ,          KC_S          ,          KC_E          ,          KC_N          ,          KC_F          ,         _______        ,                   _______        ,          KC_L          ,          KC_R          ,          KC_T          ,          KC_I          , LT(DaedricMedia, KC_U) ,         _______        ,
+                KC_LSFT        ,          KC_Z          ,          KC_X          ,         KC_MINS        ,          KC_V          ,          KC_B          ,                           KC_DOT         ,          KC_H          ,          KC_G          ,         KC_COMM        ,          KC_K          ,         KC_RSFT        ,
+                KC_LCTL        ,         _______        ,         KC_LEFT        ,        KC_RIGHT        ,         KC_LGUI        ,               LGUI(KC_P)       ,      LGUI(LSFT(KC_SPACE))  ,                KC_UP         ,         KC_DOWN        ,         _______        ,         _______        , CKC_LMOVE_DaedricQwerty,
+                                MO(DaedricSym)     ,         _______        ,       LGUI(KC_R)       ,             KC_LALT        ,        KC_ENTER        ,      Base_EKC_SPC
+),
+[Daedric34Base] = LAYOUT(
+                  KC_NO           ,           KC_NO           ,           KC_NO           ,           KC_NO           ,           KC_NO           ,           KC_NO           ,           KC_NO           ,                     KC_NO           ,           KC_NO           ,           KC_NO           ,           KC_NO           ,           KC_NO           ,           KC_NO           ,           KC_NO           ,
+                  KC_NO           ,            KC_Q           ,            KC_C           ,            KC_O           ,            KC_P           ,            KC_W           ,           KC_NO           ,                     KC_NO           ,            KC_J           ,            KC_M           ,            KC_D           ,           CKC_DK          ,            KC_Y           ,           KC_NO           ,
+                  KC_NO           ,            KC_A           ,        LALT_T(KC_S)       ,        LCTL_T(KC_E)       ,        LSFT_T(KC_N)       ,        LGUI_T(KC_F)       ,           KC_NO           ,                     KC_NO           ,        LGUI_T(KC_L)       ,        LSFT_T(KC_R)       ,        LCTL_T(KC_T)       ,        LALT_T(KC_I)       ,  LT(Daedric34Media, KC_U) ,           KC_NO           ,
+                  KC_NO           ,            KC_Z           ,            KC_X           ,          KC_MINS          ,            KC_V           ,            KC_B           ,                             KC_DOT          ,            KC_H           ,            KC_G           ,          KC_COMM          ,            KC_K           ,           KC_NO           ,
+                  KC_NO           ,           KC_NO           ,           KC_NO           ,           KC_NO           ,          KC_LGUI          ,                   KC_NO           ,               KC_NO           ,                 KC_NO           ,           KC_NO           ,           KC_NO           ,           KC_NO           , CKC_LMOVE_Daedric34Qwerty ,
+                                 LSFT_T(KC_BSPC)      ,  LT(Daedric34Nav, KC_ESC) ,           KC_NO           ,               KC_NO           , LT(Daedric34Nav, KC_ENTER),  LT(Daedric34Sym, KC_SPC)
+),
+[StdBase] = LAYOUT(
+             KC_ESC      ,    Base_EKC_1    ,    Base_EKC_2    ,    Base_EKC_3    ,       KC_4       ,       KC_5       , LT(StdFn, KC_ESC),           LT(StdFn, KC_ESC),       KC_6       ,       KC_7       ,       KC_8       ,       KC_9       ,       KC_0       ,      KC_INS      ,
+             KC_TAB      ,       KC_Q       ,       KC_C       ,       KC_O       ,       KC_P       ,       KC_W       ,      KC_DEL      ,                KC_BSPC     ,       KC_J       ,       KC_M       ,       KC_D       ,      CKC_DK      ,       KC_Y       ,       KC_NO      ,
+             KC_GRV      ,       KC_A       ,       KC_S       ,       KC_E       ,       KC_N       ,       KC_F       ,       KC_NO      ,                 KC_NO      ,       KC_L       ,       KC_R       ,       KC_T       ,       KC_I       ,       KC_NO      ,       KC_NO      ,
+             KC_LSFT     ,       KC_Z       ,       KC_X       ,      KC_MINS     ,       KC_V       ,       KC_B       ,                        KC_DOT      ,       KC_H       ,       KC_G       ,      KC_COMM     ,       KC_K       ,      KC_RSFT     ,
+             KC_LCTL     ,       KC_NO      ,      KC_LEFT     ,     KC_RIGHT     ,      KC_LGUI     ,               KC_NO      ,           KC_NO      ,             KC_UP      ,      KC_DOWN     ,       KC_NO      ,       KC_NO      ,       KC_NO      ,
+                               MO(StdSym)    ,       KC_NO      ,       KC_NO      ,          KC_LALT     ,     KC_ENTER     ,   Base_EKC_SPC
+),
+[DaedricQwerty] = LAYOUT(
+                 KC_ESC          ,           KC_1           ,           KC_2           ,           KC_3           ,           KC_4           ,           KC_5           ,   LT(DaedricFn, KC_ESC)  ,             LT(DaedricFn, KC_ESC)  ,           KC_6           ,           KC_7           ,           KC_8           ,           KC_9           ,           KC_0           ,          KC_INS          ,
+                 KC_TAB          ,           KC_Q           ,           KC_W           ,           KC_E           ,           KC_R           ,           KC_T           ,          KC_DEL          ,                    KC_BSPC         ,           KC_Y           ,           KC_U           ,           KC_I           ,           KC_O           ,           KC_P           ,          KC_BSLS         ,
+                 KC_GRV          ,           KC_A           ,           KC_S           ,           KC_D           ,           KC_F           ,           KC_G           ,          KC_EQL          ,                    KC_MINS         ,           KC_H           ,           KC_J           ,           KC_K           ,           KC_L           , LT(DaedricMedia, KC_SCLN),          KC_QUOT         ,
+                 KC_LSFT         ,           KC_Z           ,           KC_X           ,           KC_C           ,           KC_V           ,           KC_B           ,                             KC_N           ,           KC_M           ,          KC_COMM         ,          KC_DOT          ,          KC_SLSH         ,          KC_RSFT         ,
+                 KC_LCTL         ,          _______         ,          KC_LEFT         ,         KC_RIGHT         ,          KC_LGUI         ,                LGUI(KC_P)        ,        LGUI(LSFT(KC_SPC))    ,                 KC_UP          ,          KC_DOWN         ,          KC_LBRC         ,          KC_RBRC         ,   CKC_LMOVE_DaedricBase  ,
+                                     KC_SPC          ,          KC_LCTL         ,        LGUI(KC_R)        ,              KC_LALT         ,         KC_ENTER         ,          KC_SPC
+),
+[DaedricSym] = LAYOUT(
+          _______  ,  Sym_EKC_1 ,  Sym_EKC_2 ,  Sym_EKC_3 ,  Sym_EKC_4 ,  Sym_EKC_5 ,   _______  ,             _______  ,  Sym_EKC_6 ,  Sym_EKC_7 ,  Sym_EKC_8 ,  Sym_EKC_9 ,  Sym_EKC_0 ,   _______  ,
+          _______  ,  Sym_EKC_Q ,  Sym_EKC_C ,  Sym_EKC_O ,   KC_DLR   ,  Sym_EKC_W ,   _______  ,             _______  ,  Sym_EKC_J ,   KC_AMPR  ,  Sym_EKC_D , Sym_EKC_DK ,  Sym_EKC_Y ,   _______  ,
+          _______  ,  Sym_EKC_A ,   KC_LPRN  ,   KC_RPRN  ,  Sym_EKC_N ,  Sym_EKC_F ,   _______  ,             _______  ,  Sym_EKC_L ,  Sym_EKC_R ,  Sym_EKC_T ,  Sym_EKC_I ,  Sym_EKC_U ,   _______  ,
+          _______  ,  Sym_EKC_Z ,  Sym_EKC_X , Sym_EKC_MNS,  Sym_EKC_V ,   KC_HASH  ,                   Sym_EKC_DOT,  Sym_EKC_H ,  Sym_EKC_G ,   KC_COLN  ,  Sym_EKC_K ,   _______  ,
+          _______  ,   _______  ,   _______  ,   _______  ,   _______  ,           _______  ,       _______  ,         _______  ,   _______  ,   _______  ,   _______  ,   _______  ,
+                              _______  ,   _______  ,   _______  ,       _______  ,   _______  ,   KC_SPC
+),
+[DaedricMedia] = LAYOUT(
+        _______, _______, _______, _______, _______, _______, _______,           _______, _______, _______, _______, _______, KC_PWR , QK_BOOT,
+        _______, _______, _______, _______, _______, _______, _______,           _______, _______, _______, _______, _______, _______, _______,
+        _______, _______, _______, _______, _______, _______, _______,           _______, _______, _______, KC_MPRV, KC_MNXT, _______, KC_MPLY,
+        _______, _______, _______, _______, _______, _______,                   _______, _______, _______, _______, _______, _______,
+        _______, _______, UC_PREV, UC_NEXT, _______,         _______,     _______,       KC_PGUP, KC_PGDN, _______, _______, _______,
+                            _______, _______, _______,     _______, _______, _______
+),
+[DaedricFn] = LAYOUT(
+         KC_F1  ,  KC_F2  ,  KC_F3  ,  KC_F4  ,  KC_F5  ,  KC_F6  , _______ ,           _______ ,  KC_F7  ,  KC_F8  ,  KC_F9  ,  KC_F10 ,  KC_F11 ,  KC_F12 ,
+        _______ , _______ , _______ , _______ , _______ , _______ , RGB_VAI ,           _______ , _______ , _______ , _______ , _______ , _______ , _______ ,
+        _______ , AC_TOGG , AS_TOGG , CKC_HOST, _______ , _______ , RGB_VAD ,           _______ , _______ , _______ , _______ , _______ , _______ , _______ ,
+        _______ , _______ , _______ , _______ , _______ , _______ ,                   _______ , _______ , _______ , _______ , _______ , _______ ,
+        _______ , _______ , _______ , _______ , _______ ,         _______ ,     _______ ,       _______ , _______ , _______ , _______ , _______ ,
+                            _______ , _______ , _______ ,     _______ , _______ , _______
+),
+[Daedric34Qwerty] = LAYOUT(
+                   _______            ,            _______            ,            _______            ,            _______            ,            _______            ,            _______            ,            _______            ,                      _______            ,            _______            ,            _______            ,            _______            ,            _______            ,            _______            ,            _______            ,
+                   _______            ,              KC_Q             ,              KC_W             ,              KC_E             ,              KC_R             ,              KC_T             ,            _______            ,                      _______            ,              KC_Y             ,              KC_U             ,              KC_I             ,              KC_O             ,              KC_P             ,            _______            ,
+                   _______            ,              KC_A             ,          LALT_T(KC_S)         ,          LCTL_T(KC_D)         ,          LSFT_T(KC_F)         ,          LGUI_T(KC_G)         ,            _______            ,                      _______            ,          LGUI_T(KC_H)         ,          LSFT_T(KC_J)         ,          LCTL_T(KC_K)         ,          LALT_T(KC_L)         ,  LT(Daedric34Media, KC_SCLN)  ,            _______            ,
+                   _______            ,              KC_Z             ,              KC_X             ,              KC_C             ,              KC_V             ,              KC_B             ,                                KC_N             ,              KC_M             ,            KC_COMM            ,             KC_DOT            ,            KC_SLSH            ,            _______            ,
+                   _______            ,            _______            ,            _______            ,            _______            ,            KC_LGUI            ,                    _______            ,                _______            ,                  _______            ,            _______            ,            _______            ,            _______            ,    CKC_LMOVE_Daedric34Base    ,
+                                   LSFT_T(KC_BSPC)        ,    LT(Daedric34Nav, KC_ESC)   ,            _______            ,                _______            ,   LT(Daedric34Nav, KC_ENTER)  , LT(Daedric34SymQwerty, KC_SPC)
+),
+[Daedric34Sym] = LAYOUT(
+          _______  ,   _______  ,   _______  ,   _______  ,   _______  ,   _______  ,   _______  ,             _______  ,   _______  ,   _______  ,   _______  ,   _______  ,   _______  ,   _______  ,
+          _______  ,  Sym_EKC_Q ,  Sym_EKC_C ,  Sym_EKC_O ,   KC_DLR   ,  Sym_EKC_W ,   _______  ,             _______  ,  Sym_EKC_J ,   KC_AMPR  ,  Sym_EKC_D , Sym_EKC_DK ,  Sym_EKC_Y ,   _______  ,
+          _______  ,  Sym_EKC_A ,   KC_LPRN  ,   KC_RPRN  ,  Sym_EKC_N ,  Sym_EKC_F ,   _______  ,             _______  ,  Sym_EKC_L ,  Sym_EKC_R ,  Sym_EKC_T ,  Sym_EKC_I ,  Sym_EKC_U ,   _______  ,
+          _______  ,  Sym_EKC_Z ,  Sym_EKC_X , Sym_EKC_MNS,  Sym_EKC_V ,   KC_HASH  ,                   Sym_EKC_DOT,  Sym_EKC_H ,  Sym_EKC_G ,   KC_COLN  ,  Sym_EKC_K ,   _______  ,
+          _______  ,   _______  ,   _______  ,   _______  ,   _______  ,           _______  ,       _______  ,         _______  ,   _______  ,   _______  ,   _______  ,   _______  ,
+                              _______  ,   _______  ,   _______  ,       _______  ,   _______  ,   _______
+),
+[Daedric34SymQwerty] = LAYOUT(
+        _______, _______, _______, _______, _______, _______, _______,           _______, _______, _______, _______, _______, _______, _______,
+        _______, KC_CIRC,  KC_LT ,  KC_GT , KC_DLR , KC_PERC, _______,           _______,  KC_AT , KC_AMPR, KC_ASTR, KC_QUOT, KC_GRV , _______,
+        _______, KC_LCBR, KC_LPRN, KC_RPRN, KC_RCBR, KC_EQL , _______,           _______, KC_BSLS, KC_PLUS, KC_MINS, KC_SLSH, KC_DQT , _______,
+        _______, KC_TILD, KC_LBRC, KC_RBRC, KC_UNDS, KC_HASH,                   KC_PIPE, KC_EXLM, KC_SCLN, KC_COLN, KC_QUES, _______,
+        _______, _______, _______, _______, _______,         _______,     _______,       _______, _______, _______, _______, _______,
+                            _______, _______, _______,     _______, _______, _______
+),
+[Daedric34Nav] = LAYOUT(
+          _______   ,   _______   ,   _______   ,   _______   ,   _______   ,   _______   ,   _______   ,             _______   ,   _______   ,   _______   ,   _______   ,   _______   ,   _______   ,   _______   ,
+          _______   ,    KC_TAB   ,   KC_HOME   ,    KC_UP    ,    KC_END   ,   KC_PGUP   ,   _______   ,             _______   ,   KC_PPLS   ,     KC_7    ,     KC_8    ,     KC_9    ,   KC_ASTR   ,   _______   ,
+          _______   ,   CW_TOGG   ,   KC_LEFT   ,   KC_DOWN   ,   KC_RGHT   ,   KC_PGDN   ,   _______   ,             _______   ,   KC_PMNS   ,     KC_4    , LCTL_T(KC_5),     KC_6    ,    KC_EQL   ,   _______   ,
+          _______   ,   _______   ,   _______   ,    KC_INS   ,   KC_RSFT   ,    KC_DEL   ,                       KC_0    ,     KC_1    ,     KC_2    ,     KC_3    ,    KC_DOT   ,   _______   ,
+          _______   ,   _______   ,   _______   ,   _______   ,   KC_LGUI   ,           _______   ,       _______   ,         _______   ,   _______   ,   _______   ,   _______   ,   _______   ,
+                              _______   ,   _______   ,   _______   ,       _______   ,   _______   ,   _______
+),
+[Daedric34Media] = LAYOUT(
+        _______, _______, _______, _______, _______, _______, _______,           _______, _______, _______, _______, _______, _______, _______,
+        _______, _______, _______, _______, _______, _______, _______,           _______, _______, _______, _______, _______, KC_PWR , QK_BOOT,
+        _______, _______, _______, _______, _______, _______, _______,           _______, _______, _______, KC_MPRV, KC_MNXT, _______, KC_MPLY,
+        _______, _______, UC_PREV, UC_NEXT, _______, _______,                   _______, _______, _______, _______, _______, _______,
+        _______, _______, _______, _______, _______,         _______,     _______,       _______, _______, _______, _______, _______,
+                            _______, _______, _______,     _______, _______, _______
+),
+[Daedric34Fn] = LAYOUT(
+        _______ , _______ , _______ , _______ , _______ , _______ , _______ ,           _______ , _______ , _______ , _______ , _______ , _______ , _______ ,
+        _______ , AC_TOGG , CKC_HOST, _______ , _______ , _______ , _______ ,           _______ , _______ , _______ , _______ , _______ , _______ , _______ ,
+        _______ ,  KC_F1  ,  KC_F2  ,  KC_F3  ,  KC_F4  ,  KC_F5  , _______ ,           _______ ,  KC_F6  ,  KC_F7  ,  KC_F8  ,  KC_F9  ,  KC_F10 , _______ ,
+        _______ , _______ , _______ , _______ , _______ , _______ ,                    KC_F11 ,  KC_F12 , _______ , _______ , _______ , _______ ,
+        _______ , _______ , _______ , _______ , _______ ,         _______ ,     _______ ,       _______ , _______ , _______ , _______ , _______ ,
+                            _______ , _______ , _______ ,     _______ , _______ , _______
+),
+[StdSym] = LAYOUT(
+          _______  ,  Sym_EKC_1 ,  Sym_EKC_2 ,  Sym_EKC_3 ,  Sym_EKC_4 ,  Sym_EKC_5 ,   _______  ,             _______  ,  Sym_EKC_6 ,  Sym_EKC_7 ,  Sym_EKC_8 ,  Sym_EKC_9 ,  Sym_EKC_0 ,   _______  ,
+          _______  ,  Sym_EKC_Q ,  Sym_EKC_C ,  Sym_EKC_O ,   KC_DLR   ,  Sym_EKC_W ,   _______  ,             _______  ,  Sym_EKC_J ,   KC_AMPR  ,  Sym_EKC_D , Sym_EKC_DK ,  Sym_EKC_Y ,   _______  ,
+          _______  ,  Sym_EKC_A ,   KC_LPRN  ,   KC_RPRN  ,  Sym_EKC_N ,  Sym_EKC_F ,   _______  ,             _______  ,  Sym_EKC_L ,  Sym_EKC_R ,  Sym_EKC_T ,  Sym_EKC_I ,   _______  ,   _______  ,
+          _______  ,  Sym_EKC_Z ,  Sym_EKC_X , Sym_EKC_MNS,  Sym_EKC_V ,   KC_HASH  ,                   Sym_EKC_DOT,  Sym_EKC_H ,  Sym_EKC_G ,   KC_COLN  ,  Sym_EKC_K ,   _______  ,
+          _______  ,   _______  ,   _______  ,   _______  ,   _______  ,           _______  ,       _______  ,         _______  ,   _______  ,   _______  ,   _______  ,   _______  ,
+                              _______  ,   _______  ,   _______  ,       _______  ,   _______  ,   KC_SPC
+),
+[StdFn] = LAYOUT(
+         KC_F1  ,  KC_F2  ,  KC_F3  ,  KC_F4  ,  KC_F5  ,  KC_F6  , _______ ,           _______ ,  KC_F7  ,  KC_F8  ,  KC_F9  ,  KC_F10 ,  KC_F11 ,  KC_F12 ,
+        _______ , _______ , _______ , _______ , _______ , _______ , _______ ,           _______ , _______ , _______ , _______ , _______ , _______ , _______ ,
+        _______ , _______ , _______ , _______ , _______ , _______ , _______ ,           _______ , _______ , _______ , _______ , _______ , _______ , _______ ,
+        _______ , _______ , _______ , _______ , _______ , _______ ,                   _______ , _______ , _______ , _______ , _______ , _______ ,
+        _______ , CKC_HOST, UC_PREV , UC_NEXT , QK_BOOT ,         _______ ,     _______ ,       _______ , _______ , _______ , _______ , _______ ,
+                            _______ , _______ , _______ ,     _______ , _______ , _______
+),
+*/
+
+const uint8_t PROGMEM keymap_positions[MATRIX_ROWS][MATRIX_COLS] = LAYOUT(
+    // clang-format off
+
+         1,  2,  3,  4,  5,  6,  7,            8,  9, 10, 11, 12, 13, 14,
+        15, 16, 17, 18, 19, 20, 21,           22, 23, 24, 25, 26, 27, 28,
+        29, 30, 31, 32, 33, 34, 35,           36, 37, 38, 39, 40, 41, 42,
+        43, 44, 45, 46, 47, 48,                   49, 50, 51, 52, 53, 54,
+        55, 56, 57, 58, 59,         60,     61,       62, 63, 64, 65, 66,
+                            67, 68, 69,     70, 71, 72
+
+    // clang-format on
+    );
+
+const keymap_layer_t PROGMEM keymap_layers[LAYER_COUNT] = {
+    [DaedricBase]        = {.bitmap = {0xFF, 0xFF, 0xFF, 0xF7, 0xF3, 0xFD, 0x7F, 0x7F, 0xF6}, .rank = {0, 8, 16, 24, 31, 37, 44, 51, 58}, .offset = 0},
+    [Daedric34Base]      = {.bitmap = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, .rank = {0, 8, 16, 24, 32, 40, 48, 56, 64}, .offset = 64},
+    [StdBase]            = {.bitmap = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, .rank = {0, 8, 16, 24, 32, 40, 48, 56, 64}, .offset = 136},
+    [DaedricQwerty]      = {.bitmap = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF}, .rank = {0, 8, 16, 24, 32, 40, 48, 55, 63}, .offset = 208},
+    [DaedricSym]         = {.bitmap = {0x3E, 0x9F, 0xCF, 0xE7, 0xF3, 0xF9, 0x1F, 0x00, 0x80}, .rank = {0, 5, 11, 17, 23, 29, 35, 40, 40}, .offset = 279},
+    [DaedricMedia]       = {.bitmap = {0x00, 0x30, 0x00, 0x00, 0xC0, 0x02, 0x00, 0x63, 0x00}, .rank = {0, 0, 2, 2, 2, 4, 5, 5, 9}, .offset = 320},
+    [DaedricFn]          = {.bitmap = {0x3F, 0x3F, 0x10, 0xE0, 0x04, 0x00, 0x00, 0x00, 0x00}, .rank = {0, 6, 12, 13, 16, 17, 17, 17, 17}, .offset = 329},
+    [Daedric34Qwerty]    = {.bitmap = {0x00, 0x80, 0xCF, 0xE7, 0xF3, 0xF9, 0x1F, 0x04, 0xCE}, .rank = {0, 0, 1, 7, 13, 19, 25, 30, 31}, .offset = 346},
+    [Daedric34Sym]       = {.bitmap = {0x00, 0x80, 0xCF, 0xE7, 0xF3, 0xF9, 0x1F, 0x00, 0x00}, .rank = {0, 0, 1, 7, 13, 19, 25, 30, 30}, .offset = 382},
+    [Daedric34SymQwerty] = {.bitmap = {0x00, 0x80, 0xCF, 0xE7, 0xF3, 0xF9, 0x1F, 0x00, 0x00}, .rank = {0, 0, 1, 7, 13, 19, 25, 30, 30}, .offset = 412},
+    [Daedric34Nav]       = {.bitmap = {0x00, 0x80, 0xCF, 0xE7, 0xF3, 0xE1, 0x1F, 0x04, 0x00}, .rank = {0, 0, 1, 7, 13, 19, 23, 28, 29}, .offset = 442},
+    [Daedric34Media]     = {.bitmap = {0x00, 0x00, 0x00, 0x0C, 0xC0, 0x32, 0x00, 0x00, 0x00}, .rank = {0, 0, 0, 0, 2, 4, 7, 7, 7}, .offset = 471},
+    [Daedric34Fn]        = {.bitmap = {0x00, 0x80, 0x01, 0xE0, 0xF3, 0x01, 0x03, 0x00, 0x00}, .rank = {0, 0, 1, 2, 5, 11, 12, 14, 14}, .offset = 478},
+    [StdSym]             = {.bitmap = {0x3E, 0x9F, 0xCF, 0xE7, 0xF3, 0xF8, 0x1F, 0x00, 0x80}, .rank = {0, 5, 11, 17, 23, 29, 34, 39, 39}, .offset = 492},
+    [StdFn]              = {.bitmap = {0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00}, .rank = {0, 6, 12, 12, 12, 12, 12, 13, 16}, .offset = 532},
+};
+
+// 548 of the 1080 keys
+const uint16_t PROGMEM keymap_keycodes[] = {
+    // DaedricBase
+    KC_ESC, Base_EKC_1, Base_EKC_2, Base_EKC_3, KC_4, KC_5, LT(DaedricFn, KC_ESC), LT(DaedricFn, KC_ESC), KC_6, KC_7, KC_8, KC_9, KC_0, KC_INS, KC_TAB, KC_Q, KC_C, KC_O, KC_P, KC_W, KC_DEL, KC_BSPC, KC_J, KC_M, KC_D, CKC_DK, KC_Y, KC_GRV, KC_A, KC_S, KC_E, KC_N, KC_F, KC_L, KC_R, KC_T, KC_I, LT(DaedricMedia, KC_U), KC_LSFT, KC_Z, KC_X, KC_MINS, KC_V, KC_B, KC_DOT, KC_H, KC_G, KC_COMM, KC_K, KC_RSFT, KC_LCTL, KC_LEFT, KC_RIGHT, KC_LGUI, LGUI(KC_P), LGUI(LSFT(KC_SPACE)), KC_UP, KC_DOWN, CKC_LMOVE_DaedricQwerty, MO(DaedricSym), LGUI(KC_R), KC_LALT, KC_ENTER, Base_EKC_SPC,
+    // Daedric34Base
+    KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_Q, KC_C, KC_O, KC_P, KC_W, KC_NO, KC_NO, KC_J, KC_M, KC_D, CKC_DK, KC_Y, KC_NO, KC_NO, KC_A, LALT_T(KC_S), LCTL_T(KC_E), LSFT_T(KC_N), LGUI_T(KC_F), KC_NO, KC_NO, LGUI_T(KC_L), LSFT_T(KC_R), LCTL_T(KC_T), LALT_T(KC_I), LT(Daedric34Media, KC_U), KC_NO, KC_NO, KC_Z, KC_X, KC_MINS, KC_V, KC_B, KC_DOT, KC_H, KC_G, KC_COMM, KC_K, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_LGUI, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, CKC_LMOVE_Daedric34Qwerty, LSFT_T(KC_BSPC), LT(Daedric34Nav, KC_ESC), KC_NO, KC_NO, LT(Daedric34Nav, KC_ENTER), LT(Daedric34Sym, KC_SPC),
+    // StdBase
+    KC_ESC, Base_EKC_1, Base_EKC_2, Base_EKC_3, KC_4, KC_5, LT(StdFn, KC_ESC), LT(StdFn, KC_ESC), KC_6, KC_7, KC_8, KC_9, KC_0, KC_INS, KC_TAB, KC_Q, KC_C, KC_O, KC_P, KC_W, KC_DEL, KC_BSPC, KC_J, KC_M, KC_D, CKC_DK, KC_Y, KC_NO, KC_GRV, KC_A, KC_S, KC_E, KC_N, KC_F, KC_NO, KC_NO, KC_L, KC_R, KC_T, KC_I, KC_NO, KC_NO, KC_LSFT, KC_Z, KC_X, KC_MINS, KC_V, KC_B, KC_DOT, KC_H, KC_G, KC_COMM, KC_K, KC_RSFT, KC_LCTL, KC_NO, KC_LEFT, KC_RIGHT, KC_LGUI, KC_NO, KC_NO, KC_UP, KC_DOWN, KC_NO, KC_NO, KC_NO, MO(StdSym), KC_NO, KC_NO, KC_LALT, KC_ENTER, Base_EKC_SPC,
+    // DaedricQwerty
+    KC_ESC, KC_1, KC_2, KC_3, KC_4, KC_5, LT(DaedricFn, KC_ESC), LT(DaedricFn, KC_ESC), KC_6, KC_7, KC_8, KC_9, KC_0, KC_INS, KC_TAB, KC_Q, KC_W, KC_E, KC_R, KC_T, KC_DEL, KC_BSPC, KC_Y, KC_U, KC_I, KC_O, KC_P, KC_BSLS, KC_GRV, KC_A, KC_S, KC_D, KC_F, KC_G, KC_EQL, KC_MINS, KC_H, KC_J, KC_K, KC_L, LT(DaedricMedia, KC_SCLN), KC_QUOT, KC_LSFT, KC_Z, KC_X, KC_C, KC_V, KC_B, KC_N, KC_M, KC_COMM, KC_DOT, KC_SLSH, KC_RSFT, KC_LCTL, KC_LEFT, KC_RIGHT, KC_LGUI, LGUI(KC_P), LGUI(LSFT(KC_SPC)), KC_UP, KC_DOWN, KC_LBRC, KC_RBRC, CKC_LMOVE_DaedricBase, KC_SPC, KC_LCTL, LGUI(KC_R), KC_LALT, KC_ENTER, KC_SPC,
+    // DaedricSym
+    Sym_EKC_1, Sym_EKC_2, Sym_EKC_3, Sym_EKC_4, Sym_EKC_5, Sym_EKC_6, Sym_EKC_7, Sym_EKC_8, Sym_EKC_9, Sym_EKC_0, Sym_EKC_Q, Sym_EKC_C, Sym_EKC_O, KC_DLR, Sym_EKC_W, Sym_EKC_J, KC_AMPR, Sym_EKC_D, Sym_EKC_DK, Sym_EKC_Y, Sym_EKC_A, KC_LPRN, KC_RPRN, Sym_EKC_N, Sym_EKC_F, Sym_EKC_L, Sym_EKC_R, Sym_EKC_T, Sym_EKC_I, Sym_EKC_U, Sym_EKC_Z, Sym_EKC_X, Sym_EKC_MNS, Sym_EKC_V, KC_HASH, Sym_EKC_DOT, Sym_EKC_H, Sym_EKC_G, KC_COLN, Sym_EKC_K, KC_SPC,
+    // DaedricMedia
+    KC_PWR, QK_BOOT, KC_MPRV, KC_MNXT, KC_MPLY, UC_PREV, UC_NEXT, KC_PGUP, KC_PGDN,
+    // DaedricFn
+    KC_F1, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6, KC_F7, KC_F8, KC_F9, KC_F10, KC_F11, KC_F12, RGB_VAI, AC_TOGG, AS_TOGG, CKC_HOST, RGB_VAD,
+    // Daedric34Qwerty
+    KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y, KC_U, KC_I, KC_O, KC_P, KC_A, LALT_T(KC_S), LCTL_T(KC_D), LSFT_T(KC_F), LGUI_T(KC_G), LGUI_T(KC_H), LSFT_T(KC_J), LCTL_T(KC_K), LALT_T(KC_L), LT(Daedric34Media, KC_SCLN), KC_Z, KC_X, KC_C, KC_V, KC_B, KC_N, KC_M, KC_COMM, KC_DOT, KC_SLSH, KC_LGUI, CKC_LMOVE_Daedric34Base, LSFT_T(KC_BSPC), LT(Daedric34Nav, KC_ESC), LT(Daedric34Nav, KC_ENTER), LT(Daedric34SymQwerty, KC_SPC),
+    // Daedric34Sym
+    Sym_EKC_Q, Sym_EKC_C, Sym_EKC_O, KC_DLR, Sym_EKC_W, Sym_EKC_J, KC_AMPR, Sym_EKC_D, Sym_EKC_DK, Sym_EKC_Y, Sym_EKC_A, KC_LPRN, KC_RPRN, Sym_EKC_N, Sym_EKC_F, Sym_EKC_L, Sym_EKC_R, Sym_EKC_T, Sym_EKC_I, Sym_EKC_U, Sym_EKC_Z, Sym_EKC_X, Sym_EKC_MNS, Sym_EKC_V, KC_HASH, Sym_EKC_DOT, Sym_EKC_H, Sym_EKC_G, KC_COLN, Sym_EKC_K,
+    // Daedric34SymQwerty
+    KC_CIRC, KC_LT, KC_GT, KC_DLR, KC_PERC, KC_AT, KC_AMPR, KC_ASTR, KC_QUOT, KC_GRV, KC_LCBR, KC_LPRN, KC_RPRN, KC_RCBR, KC_EQL, KC_BSLS, KC_PLUS, KC_MINS, KC_SLSH, KC_DQT, KC_TILD, KC_LBRC, KC_RBRC, KC_UNDS, KC_HASH, KC_PIPE, KC_EXLM, KC_SCLN, KC_COLN, KC_QUES,
+    // Daedric34Nav
+    KC_TAB, KC_HOME, KC_UP, KC_END, KC_PGUP, KC_PPLS, KC_7, KC_8, KC_9, KC_ASTR, CW_TOGG, KC_LEFT, KC_DOWN, KC_RGHT, KC_PGDN, KC_PMNS, KC_4, LCTL_T(KC_5), KC_6, KC_EQL, KC_INS, KC_RSFT, KC_DEL, KC_0, KC_1, KC_2, KC_3, KC_DOT, KC_LGUI,
+    // Daedric34Media
+    KC_PWR, QK_BOOT, KC_MPRV, KC_MNXT, KC_MPLY, UC_PREV, UC_NEXT,
+    // Daedric34Fn
+    AC_TOGG, CKC_HOST, KC_F1, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6, KC_F7, KC_F8, KC_F9, KC_F10, KC_F11, KC_F12,
+    // StdSym
+    Sym_EKC_1, Sym_EKC_2, Sym_EKC_3, Sym_EKC_4, Sym_EKC_5, Sym_EKC_6, Sym_EKC_7, Sym_EKC_8, Sym_EKC_9, Sym_EKC_0, Sym_EKC_Q, Sym_EKC_C, Sym_EKC_O, KC_DLR, Sym_EKC_W, Sym_EKC_J, KC_AMPR, Sym_EKC_D, Sym_EKC_DK, Sym_EKC_Y, Sym_EKC_A, KC_LPRN, KC_RPRN, Sym_EKC_N, Sym_EKC_F, Sym_EKC_L, Sym_EKC_R, Sym_EKC_T, Sym_EKC_I, Sym_EKC_Z, Sym_EKC_X, Sym_EKC_MNS, Sym_EKC_V, KC_HASH, Sym_EKC_DOT, Sym_EKC_H, Sym_EKC_G, KC_COLN, Sym_EKC_K, KC_SPC,
+    // StdFn
+    KC_F1, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6, KC_F7, KC_F8, KC_F9, KC_F10, KC_F11, KC_F12, CKC_HOST, UC_PREV, UC_NEXT, QK_BOOT,
+};
+
+// Unused, QMK needs it but the layers are read through sparse_keymap.c which
+// overrides keymap_layer_count() and keycode_at_keymap_location()
+const uint16_t PROGMEM keymaps[1][MATRIX_ROWS][MATRIX_COLS] = {{{KC_NO}}};
+
+const sequence_entry_t PROGMEM sequence_entries[] = {
+    {KC_Q, UM(LATIN_SMALL_LETTER_A_WITH_CIRCUMFLEX), UM(LATIN_CAPITAL_LETTER_A_WITH_CIRCUMFLEX), SEQUENCE_NONE},
+    {KC_C, UM(LATIN_SMALL_LETTER_C_WITH_CEDILLA), UM(LATIN_CAPITAL_LETTER_C_WITH_CEDILLA), SEQUENCE_NONE},
+    {KC_O, UM(LATIN_SMALL_LIGATURE_OE), UM(LATIN_CAPITAL_LIGATURE_OE), SEQUENCE_NONE},
+    {KC_P, UM(LATIN_SMALL_LETTER_O_WITH_CIRCUMFLEX), UM(LATIN_CAPITAL_LETTER_O_WITH_CIRCUMFLEX), SEQUENCE_NONE},
+    {KC_M, UM(MICRO_SIGN), UM(MICRO_SIGN), SEQUENCE_NONE},
+    {KC_D, KC_UNDS, KC_UNDS, SEQUENCE_NONE},
+    {CKC_DK, UM(COMBINING_DIAERESIS), UM(INVERTED_EXCLAMATION_MARK), 1},
+    {KC_Y, UM(LATIN_SMALL_LETTER_U_WITH_CIRCUMFLEX), UM(LATIN_CAPITAL_LETTER_U_WITH_CIRCUMFLEX), SEQUENCE_NONE},
+    {KC_A, UM(LATIN_SMALL_LETTER_A_WITH_GRAVE), UM(LATIN_CAPITAL_LETTER_A_WITH_GRAVE), SEQUENCE_NONE},
+    {KC_S, UM(LATIN_SMALL_LETTER_E_WITH_ACUTE), UM(LATIN_CAPITAL_LETTER_E_WITH_ACUTE), SEQUENCE_NONE},
+    {KC_E, UM(LATIN_SMALL_LETTER_E_WITH_GRAVE), UM(LATIN_CAPITAL_LETTER_E_WITH_GRAVE), SEQUENCE_NONE},
+    {KC_N, UM(LATIN_SMALL_LETTER_E_WITH_CIRCUMFLEX), UM(LATIN_CAPITAL_LETTER_E_WITH_CIRCUMFLEX), SEQUENCE_NONE},
+    {KC_F, UM(LATIN_SMALL_LETTER_N_WITH_TILDE), UM(LATIN_CAPITAL_LETTER_N_WITH_TILDE), SEQUENCE_NONE},
+    {KC_L, KC_LPRN, KC_LPRN, SEQUENCE_NONE},
+    {KC_R, KC_RPRN, KC_RPRN, SEQUENCE_NONE},
+    {KC_T, UM(LATIN_SMALL_LETTER_I_WITH_CIRCUMFLEX), UM(LATIN_CAPITAL_LETTER_I_WITH_CIRCUMFLEX), SEQUENCE_NONE},
+    {KC_I, UM(LATIN_SMALL_LETTER_I_WITH_DIAERESIS), UM(LATIN_CAPITAL_LETTER_I_WITH_DIAERESIS), SEQUENCE_NONE},
+    {KC_U, UM(LATIN_SMALL_LETTER_U_WITH_GRAVE), UM(LATIN_CAPITAL_LETTER_U_WITH_GRAVE), SEQUENCE_NONE},
+    {KC_Z, UM(LATIN_SMALL_LETTER_AE), UM(LATIN_CAPITAL_LETTER_AE), SEQUENCE_NONE},
+    {KC_X, UM(LATIN_SMALL_LETTER_SHARP_S), UM(LATIN_CAPITAL_LETTER_SHARP_S), SEQUENCE_NONE},
+    {KC_MINS, UM(NON_BREAKING_HYPHEN), UM(INVERTED_QUESTION_MARK), SEQUENCE_NONE},
+    {KC_V, UM(EN_DASH), UM(EN_DASH), SEQUENCE_NONE},
+    {KC_B, UM(EM_DASH), UM(EM_DASH), SEQUENCE_NONE},
+    {KC_DOT, UM(HORIZONTAL_ELLIPSIS), UM(HORIZONTAL_ELLIPSIS), SEQUENCE_NONE},
+    {KC_COMM, UM(MIDDLE_DOT), UM(BULLET), SEQUENCE_NONE},
+    {Base_EKC_1, UM(DOUBLE_LOW_9_QUOTATION_MARK), UM(SINGLE_LOW_9_QUOTATION_MARK), SEQUENCE_NONE},
+    {Base_EKC_2, UM(LEFT_DOUBLE_QUOTATION_MARK), UM(LEFT_SINGLE_QUOTATION_MARK), SEQUENCE_NONE},
+    {Base_EKC_3, UM(RIGHT_DOUBLE_QUOTATION_MARK), UM(RIGHT_SINGLE_QUOTATION_MARK), SEQUENCE_NONE},
+    {KC_4, UM(CENT_SIGN), UM(CENT_SIGN), SEQUENCE_NONE},
+    {KC_5, UM(PER_MILLE_SIGN), UM(PER_MILLE_SIGN), SEQUENCE_NONE},
+    {KC_8, UM(SECTION_SIGN), UM(SECTION_SIGN), SEQUENCE_NONE},
+    {KC_9, UM(PILCROW_SIGN), UM(PILCROW_SIGN), SEQUENCE_NONE},
+    {KC_0, UM(DEGREE_SIGN), UM(DEGREE_SIGN), SEQUENCE_NONE},
+    {Base_EKC_SPC, UM(RIGHT_SINGLE_QUOTATION_MARK), UM(RIGHT_SINGLE_QUOTATION_MARK), SEQUENCE_NONE},
+    {Sym_EKC_F, KC_EQL, KC_EQL, 2},
+    {KC_A, UM(LATIN_SMALL_LETTER_A_WITH_DIAERESIS), UM(LATIN_CAPITAL_LETTER_A_WITH_DIAERESIS), SEQUENCE_NONE},
+    {KC_E, UM(LATIN_SMALL_LETTER_E_WITH_DIAERESIS), UM(LATIN_CAPITAL_LETTER_E_WITH_DIAERESIS), SEQUENCE_NONE},
+    {KC_I, UM(LATIN_SMALL_LETTER_I_WITH_DIAERESIS), UM(LATIN_CAPITAL_LETTER_I_WITH_DIAERESIS), SEQUENCE_NONE},
+    {KC_O, UM(LATIN_SMALL_LETTER_O_WITH_DIAERESIS), UM(LATIN_CAPITAL_LETTER_O_WITH_DIAERESIS), SEQUENCE_NONE},
+    {KC_U, UM(LATIN_SMALL_LETTER_U_WITH_DIAERESIS), UM(LATIN_CAPITAL_LETTER_U_WITH_DIAERESIS), SEQUENCE_NONE},
+    {KC_Y, UM(LATIN_SMALL_LETTER_Y_WITH_DIAERESIS), UM(LATIN_CAPITAL_LETTER_Y_WITH_DIAERESIS), SEQUENCE_NONE},
+    {Sym_EKC_I, UM(NOT_EQUAL_TO), UM(NOT_EQUAL_TO), SEQUENCE_NONE},
+};
+
+const sequence_node_t PROGMEM sequence_nodes[] = {
+    {0, 35},
+    {35, 6},
+    {41, 1},
+};
+
+#ifdef AUTOCORRECT_ENABLE
+#    include "autocorrect_trie.h"
+
+const uint8_t PROGMEM autocorrect_unicode[UNICODE_MAP_COUNT] = {
+    [LATIN_SMALL_LETTER_A_WITH_CIRCUMFLEX]       = 30 /* â */,
+    [LATIN_CAPITAL_LETTER_A_WITH_CIRCUMFLEX]     = 30 /* â */,
+    [LATIN_SMALL_LETTER_C_WITH_CEDILLA]          = 32 /* ç */,
+    [LATIN_CAPITAL_LETTER_C_WITH_CEDILLA]        = 32 /* ç */,
+    [LATIN_SMALL_LIGATURE_OE]                    = 40 /* œ */,
+    [LATIN_CAPITAL_LIGATURE_OE]                  = 40 /* œ */,
+    [LATIN_SMALL_LETTER_O_WITH_CIRCUMFLEX]       = 39 /* ô */,
+    [LATIN_CAPITAL_LETTER_O_WITH_CIRCUMFLEX]     = 39 /* ô */,
+    [PER_MILLE_SIGN]                             = AUTOCORRECT_BOUNDARY /* : */,
+    [INVERTED_EXCLAMATION_MARK]                  = AUTOCORRECT_BOUNDARY /* : */,
+    [LATIN_SMALL_LETTER_U_WITH_CIRCUMFLEX]       = 42 /* û */,
+    [LATIN_CAPITAL_LETTER_U_WITH_CIRCUMFLEX]     = 42 /* û */,
+    [LATIN_SMALL_LETTER_A_WITH_GRAVE]            = 29 /* à */,
+    [LATIN_CAPITAL_LETTER_A_WITH_GRAVE]          = 29 /* à */,
+    [LATIN_SMALL_LETTER_E_WITH_ACUTE]            = 33 /* é */,
+    [LATIN_CAPITAL_LETTER_E_WITH_ACUTE]          = 33 /* é */,
+    [LATIN_SMALL_LETTER_E_WITH_GRAVE]            = 34 /* è */,
+    [LATIN_CAPITAL_LETTER_E_WITH_GRAVE]          = 34 /* è */,
+    [LATIN_SMALL_LETTER_E_WITH_CIRCUMFLEX]       = 35 /* ê */,
+    [LATIN_CAPITAL_LETTER_E_WITH_CIRCUMFLEX]     = 35 /* ê */,
+    [LATIN_SMALL_LETTER_I_WITH_CIRCUMFLEX]       = 37 /* î */,
+    [LATIN_CAPITAL_LETTER_I_WITH_CIRCUMFLEX]     = 37 /* î */,
+    [LATIN_SMALL_LETTER_I_WITH_DIAERESIS]        = 38 /* ï */,
+    [LATIN_CAPITAL_LETTER_I_WITH_DIAERESIS]      = 38 /* ï */,
+    [LATIN_SMALL_LETTER_U_WITH_GRAVE]            = 41 /* ù */,
+    [LATIN_CAPITAL_LETTER_U_WITH_GRAVE]          = 41 /* ù */,
+    [LATIN_SMALL_LETTER_AE]                      = 31 /* æ */,
+    [LATIN_CAPITAL_LETTER_AE]                    = 31 /* æ */,
+    [NON_BREAKING_HYPHEN]                        = AUTOCORRECT_BOUNDARY /* : */,
+    [INVERTED_QUESTION_MARK]                     = AUTOCORRECT_BOUNDARY /* : */,
+    [EN_DASH]                                    = AUTOCORRECT_BOUNDARY /* : */,
+    [EM_DASH]                                    = AUTOCORRECT_BOUNDARY /* : */,
+    [HORIZONTAL_ELLIPSIS]                        = AUTOCORRECT_BOUNDARY /* : */,
+    [MIDDLE_DOT]                                 = AUTOCORRECT_BOUNDARY /* : */,
+    [BULLET]                                     = AUTOCORRECT_BOUNDARY /* : */,
+    [DOUBLE_LOW_9_QUOTATION_MARK]                = AUTOCORRECT_BOUNDARY /* : */,
+    [SINGLE_LOW_9_QUOTATION_MARK]                = AUTOCORRECT_BOUNDARY /* : */,
+    [LEFT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK]  = AUTOCORRECT_BOUNDARY /* : */,
+    [LEFT_DOUBLE_QUOTATION_MARK]                 = AUTOCORRECT_BOUNDARY /* : */,
+    [LEFT_SINGLE_QUOTATION_MARK]                 = AUTOCORRECT_BOUNDARY /* : */,
+    [RIGHT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK] = AUTOCORRECT_BOUNDARY /* : */,
+    [RIGHT_DOUBLE_QUOTATION_MARK]                = AUTOCORRECT_BOUNDARY /* : */,
+    [RIGHT_SINGLE_QUOTATION_MARK]                = 2 /* ' */,
+    [SECTION_SIGN]                               = AUTOCORRECT_BOUNDARY /* : */,
+    [PILCROW_SIGN]                               = AUTOCORRECT_BOUNDARY /* : */,
+    [NARROW_NO_BREAK_SPACE]                      = AUTOCORRECT_BOUNDARY /* : */,
+    [LATIN_SMALL_LETTER_E_WITH_DIAERESIS]        = 36 /* ë */,
+    [LATIN_CAPITAL_LETTER_E_WITH_DIAERESIS]      = 36 /* ë */,
+    [LATIN_SMALL_LETTER_U_WITH_DIAERESIS]        = 43 /* ü */,
+    [LATIN_CAPITAL_LETTER_U_WITH_DIAERESIS]      = 43 /* ü */,
+    [LATIN_SMALL_LETTER_Y_WITH_DIAERESIS]        = 44 /* ÿ */,
+    [LATIN_CAPITAL_LETTER_Y_WITH_DIAERESIS]      = 44 /* ÿ */,
+};
+
+const autocorrect_key_t PROGMEM autocorrect_keys[] = {
+    {KC_QUOT, 2}, // '
+    {KC_A, 3}, // a
+    {KC_B, 4}, // b
+    {KC_C, 5}, // c
+    {KC_D, 6}, // d
+    {KC_E, 7}, // e
+    {KC_F, 8}, // f
+    {KC_G, 9}, // g
+    {KC_H, 10}, // h
+    {KC_I, 11}, // i
+    {KC_J, 12}, // j
+    {KC_K, 13}, // k
+    {KC_L, 14}, // l
+    {KC_M, 15}, // m
+    {KC_N, 16}, // n
+    {KC_O, 17}, // o
+    {KC_P, 18}, // p
+    {KC_Q, 19}, // q
+    {KC_R, 20}, // r
+    {KC_S, 21}, // s
+    {KC_T, 22}, // t
+    {KC_U, 23}, // u
+    {KC_V, 24}, // v
+    {KC_W, 25}, // w
+    {KC_X, 26}, // x
+    {KC_Y, 27}, // y
+    {KC_Z, 28}, // z
+    {KC_1, AUTOCORRECT_BOUNDARY}, // :
+    {KC_2, AUTOCORRECT_BOUNDARY}, // :
+    {KC_3, AUTOCORRECT_BOUNDARY}, // :
+    {KC_4, AUTOCORRECT_BOUNDARY}, // :
+    {KC_5, AUTOCORRECT_BOUNDARY}, // :
+    {KC_6, AUTOCORRECT_BOUNDARY}, // :
+    {KC_7, AUTOCORRECT_BOUNDARY}, // :
+    {KC_8, AUTOCORRECT_BOUNDARY}, // :
+    {KC_9, AUTOCORRECT_BOUNDARY}, // :
+    {KC_0, AUTOCORRECT_BOUNDARY}, // :
+    {KC_MINS, AUTOCORRECT_BOUNDARY}, // :
+    {KC_DOT, AUTOCORRECT_BOUNDARY}, // :
+    {KC_COMM, AUTOCORRECT_BOUNDARY}, // :
+    {KC_SPC, AUTOCORRECT_BOUNDARY}, // :
+    {KC_CIRC, AUTOCORRECT_BOUNDARY}, // :
+    {KC_LABK, AUTOCORRECT_BOUNDARY}, // :
+    {KC_RABK, AUTOCORRECT_BOUNDARY}, // :
+    {KC_DLR, AUTOCORRECT_BOUNDARY}, // :
+    {KC_PERC, AUTOCORRECT_BOUNDARY}, // :
+    {KC_AT, AUTOCORRECT_BOUNDARY}, // :
+    {KC_AMPR, AUTOCORRECT_BOUNDARY}, // :
+    {KC_ASTR, AUTOCORRECT_BOUNDARY}, // :
+    {KC_GRV, AUTOCORRECT_BOUNDARY}, // :
+    {KC_LCBR, AUTOCORRECT_BOUNDARY}, // :
+    {KC_LPRN, AUTOCORRECT_BOUNDARY}, // :
+    {KC_RPRN, AUTOCORRECT_BOUNDARY}, // :
+    {KC_RCBR, AUTOCORRECT_BOUNDARY}, // :
+    {KC_EQL, AUTOCORRECT_BOUNDARY}, // :
+    {KC_BSLS, AUTOCORRECT_BOUNDARY}, // :
+    {KC_PLUS, AUTOCORRECT_BOUNDARY}, // :
+    {KC_SLSH, AUTOCORRECT_BOUNDARY}, // :
+    {KC_DQUO, AUTOCORRECT_BOUNDARY}, // :
+    {KC_TILD, AUTOCORRECT_BOUNDARY}, // :
+    {KC_LBRC, AUTOCORRECT_BOUNDARY}, // :
+    {KC_RBRC, AUTOCORRECT_BOUNDARY}, // :
+    {KC_UNDS, AUTOCORRECT_BOUNDARY}, // :
+    {KC_HASH, AUTOCORRECT_BOUNDARY}, // :
+    {KC_PIPE, AUTOCORRECT_BOUNDARY}, // :
+    {KC_EXLM, AUTOCORRECT_BOUNDARY}, // :
+    {KC_SCLN, AUTOCORRECT_BOUNDARY}, // :
+    {KC_COLN, AUTOCORRECT_BOUNDARY}, // :
+    {KC_QUES, AUTOCORRECT_BOUNDARY}, // :
+    {KC_ENT, AUTOCORRECT_BOUNDARY}, // :
+    {KC_TAB, AUTOCORRECT_BOUNDARY}, // :
+    {CKC_DK, AUTOCORRECT_BOUNDARY}, // :
+    {KC_NO, AUTOCORRECT_NONE},
+};
+
+const uint16_t PROGMEM autocorrect_keycodes[] = {
+    [AUTOCORRECT_BOUNDARY] = KC_SPC,
+    [2]                    = KC_QUOT /* ' */,
+    [3]                    = KC_A /* a */,
+    [4]                    = KC_B /* b */,
+    [5]                    = KC_C /* c */,
+    [6]                    = KC_D /* d */,
+    [7]                    = KC_E /* e */,
+    [8]                    = KC_F /* f */,
+    [9]                    = KC_G /* g */,
+    [10]                   = KC_H /* h */,
+    [11]                   = KC_I /* i */,
+    [12]                   = KC_J /* j */,
+    [13]                   = KC_K /* k */,
+    [14]                   = KC_L /* l */,
+    [15]                   = KC_M /* m */,
+    [16]                   = KC_N /* n */,
+    [17]                   = KC_O /* o */,
+    [18]                   = KC_P /* p */,
+    [19]                   = KC_Q /* q */,
+    [20]                   = KC_R /* r */,
+    [21]                   = KC_S /* s */,
+    [22]                   = KC_T /* t */,
+    [23]                   = KC_U /* u */,
+    [24]                   = KC_V /* v */,
+    [25]                   = KC_W /* w */,
+    [26]                   = KC_X /* x */,
+    [27]                   = KC_Y /* y */,
+    [28]                   = KC_Z /* z */,
+    [29]                   = UM(LATIN_SMALL_LETTER_A_WITH_GRAVE) /* à */,
+    [30]                   = UM(LATIN_SMALL_LETTER_A_WITH_CIRCUMFLEX) /* â */,
+    [31]                   = UM(LATIN_SMALL_LETTER_AE) /* æ */,
+    [32]                   = UM(LATIN_SMALL_LETTER_C_WITH_CEDILLA) /* ç */,
+    [33]                   = UM(LATIN_SMALL_LETTER_E_WITH_ACUTE) /* é */,
+    [34]                   = UM(LATIN_SMALL_LETTER_E_WITH_GRAVE) /* è */,
+    [35]                   = UM(LATIN_SMALL_LETTER_E_WITH_CIRCUMFLEX) /* ê */,
+    [36]                   = UM(LATIN_SMALL_LETTER_E_WITH_DIAERESIS) /* ë */,
+    [37]                   = UM(LATIN_SMALL_LETTER_I_WITH_CIRCUMFLEX) /* î */,
+    [38]                   = UM(LATIN_SMALL_LETTER_I_WITH_DIAERESIS) /* ï */,
+    [39]                   = UM(LATIN_SMALL_LETTER_O_WITH_CIRCUMFLEX) /* ô */,
+    [40]                   = UM(LATIN_SMALL_LIGATURE_OE) /* œ */,
+    [41]                   = UM(LATIN_SMALL_LETTER_U_WITH_GRAVE) /* ù */,
+    [42]                   = UM(LATIN_SMALL_LETTER_U_WITH_CIRCUMFLEX) /* û */,
+    [43]                   = UM(LATIN_SMALL_LETTER_U_WITH_DIAERESIS) /* ü */,
+    [44]                   = UM(LATIN_SMALL_LETTER_Y_WITH_DIAERESIS) /* ÿ */,
+};
+
+const uint8_t PROGMEM autocorrect_layer_tries[LAYER_COUNT] = {
+    [DaedricBase]        = 0,
+    [Daedric34Base]      = 0,
+    [StdBase]            = 0,
+    [DaedricQwerty]      = 1,
+    [DaedricSym]         = AUTOCORRECT_NO_TRIE,
+    [DaedricMedia]       = AUTOCORRECT_NO_TRIE,
+    [DaedricFn]          = AUTOCORRECT_NO_TRIE,
+    [Daedric34Qwerty]    = 1,
+    [Daedric34Sym]       = AUTOCORRECT_NO_TRIE,
+    [Daedric34SymQwerty] = AUTOCORRECT_NO_TRIE,
+    [Daedric34Nav]       = AUTOCORRECT_NO_TRIE,
+    [Daedric34Media]     = AUTOCORRECT_NO_TRIE,
+    [Daedric34Fn]        = AUTOCORRECT_NO_TRIE,
+    [StdSym]             = AUTOCORRECT_NO_TRIE,
+    [StdFn]              = AUTOCORRECT_NO_TRIE,
+};
+#endif
+
+const custom_key_t PROGMEM custom_keys[CUSTOM_KEY_COUNT] = {
+    [CKC_LMOVE_DaedricBase - KEYMAP_SAFE_RANGE]        = {TO(DaedricBase), 0},
+    [CKC_LMOVE_Daedric34Base - KEYMAP_SAFE_RANGE]      = {TO(Daedric34Base), 0},
+    [CKC_LMOVE_StdBase - KEYMAP_SAFE_RANGE]            = {TO(StdBase), 0},
+    [CKC_LMOVE_DaedricQwerty - KEYMAP_SAFE_RANGE]      = {TO(DaedricQwerty), 0},
+    [CKC_LMOVE_DaedricSym - KEYMAP_SAFE_RANGE]         = {TO(DaedricSym), 0},
+    [CKC_LMOVE_DaedricMedia - KEYMAP_SAFE_RANGE]       = {TO(DaedricMedia), 0},
+    [CKC_LMOVE_DaedricFn - KEYMAP_SAFE_RANGE]          = {TO(DaedricFn), 0},
+    [CKC_LMOVE_Daedric34Qwerty - KEYMAP_SAFE_RANGE]    = {TO(Daedric34Qwerty), 0},
+    [CKC_LMOVE_Daedric34Sym - KEYMAP_SAFE_RANGE]       = {TO(Daedric34Sym), 0},
+    [CKC_LMOVE_Daedric34SymQwerty - KEYMAP_SAFE_RANGE] = {TO(Daedric34SymQwerty), 0},
+    [CKC_LMOVE_Daedric34Nav - KEYMAP_SAFE_RANGE]       = {TO(Daedric34Nav), 0},
+    [CKC_LMOVE_Daedric34Media - KEYMAP_SAFE_RANGE]     = {TO(Daedric34Media), 0},
+    [CKC_LMOVE_Daedric34Fn - KEYMAP_SAFE_RANGE]        = {TO(Daedric34Fn), 0},
+    [CKC_LMOVE_StdSym - KEYMAP_SAFE_RANGE]             = {TO(StdSym), 0},
+    [CKC_LMOVE_StdFn - KEYMAP_SAFE_RANGE]              = {TO(StdFn), 0},
+    [Base_EKC_1 - KEYMAP_SAFE_RANGE]                   = {KC_1, EURO_SIGN},
+    [Base_EKC_2 - KEYMAP_SAFE_RANGE]                   = {KC_2, LEFT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK},
+    [Base_EKC_3 - KEYMAP_SAFE_RANGE]                   = {KC_3, RIGHT_POINTING_DOUBLE_ANGLE_QUOTATION_MARK},
+    [Base_EKC_SPC - KEYMAP_SAFE_RANGE]                 = {KC_SPC, NARROW_NO_BREAK_SPACE},
+    [Sym_EKC_Q - KEYMAP_SAFE_RANGE]                    = {KC_CIRC, COMBINING_CIRCUMFLEX_ACCENT},
+    [Sym_EKC_C - KEYMAP_SAFE_RANGE]                    = {KC_LABK, LESS_THAN_OR_EQUAL_TO},
+    [Sym_EKC_O - KEYMAP_SAFE_RANGE]                    = {KC_RABK, GREATER_THAN_OR_EQUAL_TO},
+    [Sym_EKC_W - KEYMAP_SAFE_RANGE]                    = {KC_PERC, PER_MILLE_SIGN},
+    [Sym_EKC_J - KEYMAP_SAFE_RANGE]                    = {KC_AT, COMBINING_RING_ABOVE},
+    [Sym_EKC_D - KEYMAP_SAFE_RANGE]                    = {KC_ASTR, MULTIPLICATION_SIGN},
+    [Sym_EKC_DK - KEYMAP_SAFE_RANGE]                   = {KC_QUOT, COMBINING_ACUTE_ACCENT},
+    [Sym_EKC_Y - KEYMAP_SAFE_RANGE]                    = {KC_GRV, COMBINING_GRAVE_ACCENT},
+    [Sym_EKC_A - KEYMAP_SAFE_RANGE]                    = {KC_LCBR, COMBINING_CARON},
+    [Sym_EKC_N - KEYMAP_SAFE_RANGE]                    = {KC_RCBR, COMBINING_DOT_ABOVE},
+    [Sym_EKC_F - KEYMAP_SAFE_RANGE]                    = {KC_EQL, NOT_EQUAL_TO},
+    [Sym_EKC_L - KEYMAP_SAFE_RANGE]                    = {KC_BSLS, COMBINING_LONG_SOLIDUS_OVERLAY},
+    [Sym_EKC_R - KEYMAP_SAFE_RANGE]                    = {KC_PLUS, PLUS_SIGN_ABOVE_EQUALS_SIGN},
+    [Sym_EKC_T - KEYMAP_SAFE_RANGE]                    = {KC_MINS, COMBINING_MACRON},
+    [Sym_EKC_I - KEYMAP_SAFE_RANGE]                    = {KC_SLSH, DIVISION_SIGN},
+    [Sym_EKC_U - KEYMAP_SAFE_RANGE]                    = {KC_DQUO, COMBINING_DOUBLE_ACUTE_ACCENT},
+    [Sym_EKC_Z - KEYMAP_SAFE_RANGE]                    = {KC_TILD, COMBINING_TILDE},
+    [Sym_EKC_X - KEYMAP_SAFE_RANGE]                    = {KC_LBRC, COMBINING_COMMA_BELOW},
+    [Sym_EKC_MNS - KEYMAP_SAFE_RANGE]                  = {KC_RBRC, COMBINING_OGONEK},
+    [Sym_EKC_V - KEYMAP_SAFE_RANGE]                    = {KC_UNDS, EN_DASH},
+    [Sym_EKC_DOT - KEYMAP_SAFE_RANGE]                  = {KC_PIPE, BROKEN_BAR},
+    [Sym_EKC_H - KEYMAP_SAFE_RANGE]                    = {KC_EXLM, NOT_SIGN},
+    [Sym_EKC_G - KEYMAP_SAFE_RANGE]                    = {KC_SCLN, COMBINING_TURNED_COMMA_ABOVE},
+    [Sym_EKC_K - KEYMAP_SAFE_RANGE]                    = {KC_QUES, COMBINING_BREVE},
+};
@@ -0,0 +1,33 @@
+// Generated by scripts/gen_keymap.py, included by config.h
+
+#pragma once
+
+// DaedricBase, Daedric34Base, StdBase, DaedricQwerty, DaedricSym, DaedricMedia, DaedricFn, Daedric34Qwerty, Daedric34Sym, Daedric34SymQwerty, Daedric34Nav, Daedric34Media, Daedric34Fn, StdSym, StdFn
+#define LAYER_COUNT 15
+
+// The smallest layer_state_t for them
+// https://github.com/qmk/qmk_firmware/blob/a4da5f219fe0f202a07afa045fc0c08f6ce1f86b/docs/squeezing_avr.md#layers
+#define LAYER_STATE_16BIT
+#define RGBLIGHT_MAX_LAYERS 16
+
+// Keymaps in the firmware, daedric, daedric_34, std, and the layer of each
+// mode in them, see users/daedric/variants.h
+#define VARIANT_COUNT 3
+#define VARIANT_NO_LAYER 0xFF
+#define VARIANT_LAYERS_Base {0, 1, 2}
+#define VARIANT_LAYERS_Qwerty {3, 7, VARIANT_NO_LAYER}
+#define VARIANT_LAYERS_Sym {4, 8, 13}
+#define VARIANT_LAYERS_SymQwerty {VARIANT_NO_LAYER, 9, VARIANT_NO_LAYER}
+#define VARIANT_LAYERS_Nav {VARIANT_NO_LAYER, 10, VARIANT_NO_LAYER}
+#define VARIANT_LAYERS_Num {VARIANT_NO_LAYER, VARIANT_NO_LAYER, VARIANT_NO_LAYER}
+#define VARIANT_LAYERS_Media {5, 11, VARIANT_NO_LAYER}
+#define VARIANT_LAYERS_Fn {6, 12, 14}
+#define VARIANT_AUTOSHIFT {1, 0, 0}
+#define VARIANT_LAYER_INDEX {0, 0, 0, 1, 2, 3, 4, 1, 2, 3, 4, 5, 6, 1, 2}
+
+// Sizes of the tables of the keymap read by users/daedric
+#define KEYMAP_KEYS 72
+#define HOST_COUNT 2
+#define CUSTOM_KEY_COUNT 43
+#define UNICODE_MAP_COUNT 107
+#define UNICODE_ROUTE_COUNT 107
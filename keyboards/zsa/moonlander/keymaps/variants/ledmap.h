@@ -0,0 +1,141 @@
+// Generated by scripts/moonlander_leds.py --keymap daedric daedric_34 std, do not edit.
+#pragma once
+
+// Flash used: 194 bytes, 3240 bytes as a dense RGB table.
+
+enum led_colors {
+    LED_COLOR_BLACK,
+    LED_COLOR_GREEN,
+    LED_COLOR_PURPL,
+    LED_COLOR_RED,
+    LED_COLOR_GOLD,
+    LED_COLOR_WHITE,
+    LED_COLOR_ORANG,
+    LED_COLOR_BLUE,
+};
+
+// HSV palette converted to RGB at generation time
+const uint8_t PROGMEM led_palette[][3] = {
+    [LED_COLOR_BLACK] = {0x00, 0x00, 0x00},
+    [LED_COLOR_GREEN] = {0x00, 0xff, 0x00},
+    [LED_COLOR_PURPL] = {0x7e, 0x00, 0xff},
+    [LED_COLOR_RED]   = {0xff, 0x00, 0x00},
+    [LED_COLOR_GOLD]  = {0xff, 0xd8, 0x00},
+    [LED_COLOR_WHITE] = {0xff, 0xff, 0xff},
+    [LED_COLOR_ORANG] = {0xff, 0x7e, 0x00},
+    [LED_COLOR_BLUE]  = {0x0c, 0x00, 0xff},
+};
+
+typedef struct {
+    uint8_t led;
+    uint8_t color;
+} led_entry_t;
+
+typedef struct {
+    uint8_t offset;
+    uint8_t count;
+} led_layer_t;
+
+// LEDs set by each layer, the others show the layers below or stay off
+const led_entry_t PROGMEM ledmap_entries[] = {
+    // DaedricBase
+    {29, LED_COLOR_GREEN},
+    {32, LED_COLOR_PURPL},
+    {43, LED_COLOR_RED},
+    {47, LED_COLOR_GOLD},
+    {65, LED_COLOR_GREEN},
+    {68, LED_COLOR_PURPL},
+    // Daedric34Base
+    {29, LED_COLOR_GREEN},
+    {32, LED_COLOR_PURPL},
+    {40, LED_COLOR_GREEN},
+    {43, LED_COLOR_RED},
+    {47, LED_COLOR_GOLD},
+    {65, LED_COLOR_GREEN},
+    {68, LED_COLOR_PURPL},
+    // DaedricQwerty
+    {29, LED_COLOR_GREEN},
+    {32, LED_COLOR_BLACK},
+    {43, LED_COLOR_RED},
+    {47, LED_COLOR_BLACK},
+    {65, LED_COLOR_GREEN},
+    {68, LED_COLOR_BLACK},
+    // DaedricMedia
+    {14, LED_COLOR_RED},
+    {19, LED_COLOR_RED},
+    {36, LED_COLOR_ORANG},
+    {41, LED_COLOR_RED},
+    {55, LED_COLOR_BLUE},
+    {60, LED_COLOR_BLUE},
+    // DaedricFn
+    {7, LED_COLOR_RED},
+    {12, LED_COLOR_RED},
+    {30, LED_COLOR_WHITE},
+    {31, LED_COLOR_WHITE},
+    // Daedric34Qwerty
+    {29, LED_COLOR_BLACK},
+    {32, LED_COLOR_BLACK},
+    {40, LED_COLOR_PURPL},
+    {43, LED_COLOR_RED},
+    {47, LED_COLOR_BLACK},
+    {65, LED_COLOR_BLACK},
+    {68, LED_COLOR_BLACK},
+    // Daedric34Nav
+    {7, LED_COLOR_GOLD},
+    {12, LED_COLOR_GREEN},
+    {16, LED_COLOR_GREEN},
+    {17, LED_COLOR_GREEN},
+    {18, LED_COLOR_BLUE},
+    {22, LED_COLOR_GREEN},
+    {28, LED_COLOR_RED},
+    {47, LED_COLOR_ORANG},
+    {48, LED_COLOR_ORANG},
+    {49, LED_COLOR_ORANG},
+    {52, LED_COLOR_ORANG},
+    {53, LED_COLOR_ORANG},
+    {54, LED_COLOR_ORANG},
+    {57, LED_COLOR_ORANG},
+    {58, LED_COLOR_ORANG},
+    {59, LED_COLOR_ORANG},
+    {64, LED_COLOR_WHITE},
+    // Daedric34Media
+    {13, LED_COLOR_RED},
+    {18, LED_COLOR_RED},
+    {37, LED_COLOR_ORANG},
+    {42, LED_COLOR_RED},
+    // Daedric34Fn
+    {6, LED_COLOR_RED},
+    {7, LED_COLOR_GREEN},
+    {12, LED_COLOR_GREEN},
+    {17, LED_COLOR_GREEN},
+    {22, LED_COLOR_GREEN},
+    {27, LED_COLOR_GREEN},
+    {43, LED_COLOR_GREEN},
+    {48, LED_COLOR_GREEN},
+    {53, LED_COLOR_GREEN},
+    {58, LED_COLOR_GREEN},
+    {59, LED_COLOR_GREEN},
+    {63, LED_COLOR_GREEN},
+    {64, LED_COLOR_GREEN},
+};
+
+// In the order of the layers of the keymap
+const led_layer_t PROGMEM ledmap[] = {
+    {0, 6},   // DaedricBase
+    {6, 7},   // Daedric34Base
+    {13, 0},  // StdBase
+    {13, 6},  // DaedricQwerty
+    {19, 0},  // DaedricSym
+    {19, 6},  // DaedricMedia
+    {25, 4},  // DaedricFn
+    {29, 7},  // Daedric34Qwerty
+    {36, 0},  // Daedric34Sym
+    {36, 0},  // Daedric34SymQwerty
+    {36, 17}, // Daedric34Nav
+    {53, 4},  // Daedric34Media
+    {57, 13}, // Daedric34Fn
+    {70, 0},  // StdSym
+    {70, 0},  // StdFn
+};
+
+_Static_assert(sizeof(ledmap) / sizeof(ledmap[0]) == LAYER_COUNT, "ledmap.h is not generated for this keymap");
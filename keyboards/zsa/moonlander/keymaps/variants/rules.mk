@@ -0,0 +1,21 @@
+# TAP_DANCE_ENABLE = yes
+LTO_ENABLE = yes
+UNICODE_COMMON = yes
+# The keymap has its own 16 bits unicode_map, typed by the unicode queue
+UNICODEMAP_ENABLE = no
+CAPS_WORD_ENABLE = yes
+
+NKRO_ENABLE = yes
+MUSIC_ENABLE = no
+AUDIO_ENABLE = no
+# do not work with the dead key and overrides/UM(), turned on and off with
+# the keymap in use
+AUTO_SHIFT_ENABLE = yes
+OS_DETECTION_ENABLE = yes
+AUTOCORRECT_ENABLE = yes
+TRI_LAYER_ENABLE = yes
+# Switches between the keymaps, see users/daedric/variants.h
+COMBO_ENABLE = yes
+
+# daedric, daedric_34 and ergol in one firmware, users/daedric for all of them
+USER_NAME := daedric
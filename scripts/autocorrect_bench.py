@@ -0,0 +1,158 @@
+"""Replay a text through the autocorrect of the firmware on the host.
+
+Every autocorrect lookup runs in process_record, this gives numbers before
+adding typos to the dictionaries. users/daedric/autocorrect_trie.c is compiled
+with the autocorrect_data.h of a keymap and a stand-in quantum.h
+(scripts/bench/), and fed the text one character per keystroke, like the
+keymap feeds it: letters of the autocorrect ALPHABET, word boundaries for
+spaces, digits and punctuation, and any other key for the rest.
+
+The text is taken as correctly spelled, every correction is a false positive,
+unless `--words` gives the correct words, then only the corrections in one of
+them are:
+
+    python scripts/autocorrect_bench.py corpus.txt --words /usr/share/dict/words
+"""
+
+import argparse
+import bisect
+import collections
+import os
+import subprocess
+import sys
+import tempfile
+import unicodedata
+
+from gen_autocorrect import ALPHABET, LAYER_DICTIONARIES
+
+parser = argparse.ArgumentParser(description="Benchmark the autocorrect tries.")
+parser.add_argument("corpus", help="UTF-8 text to replay")
+parser.add_argument(
+    "--keymap",
+    choices=["daedric", "daedric_34"],
+    default="daedric",
+    help="Keymap of the autocorrect_data.h",
+)
+parser.add_argument(
+    "--layer",
+    choices=list(LAYER_DICTIONARIES),
+    default="Base",
+    help="Layer of the trie",
+)
+parser.add_argument(
+    "--words",
+    default=None,
+    help="Correctly spelled words, one per line",
+)
+parser.add_argument(
+    "--runs",
+    type=int,
+    default=5,
+    help="Timed replays, the best one is reported",
+)
+parser.add_argument("--cc", default="cc", help="Host C compiler")
+
+NONE = 0
+BOUNDARY = ALPHABET.index(":") + 1
+
+
+def char_code(c: str) -> int:
+    if c == "’":
+        c = "'"
+    if c != ":" and c in ALPHABET:
+        return ALPHABET.index(c) + 1
+    if c.isspace() or c.isdigit() or unicodedata.category(c)[0] in "PZS":
+        return BOUNDARY
+    return NONE
+
+
+def build(root: str, keymap: str, out: str) -> None:
+    subprocess.run(
+        [
+            args.cc,
+            "-O2",
+            "-std=gnu11",
+            "-I",
+            os.path.join(root, "scripts", "bench"),
+            "-I",
+            os.path.join(root, "users", "daedric"),
+            "-I",
+            os.path.join(root, "keyboards", "zsa", "moonlander", "keymaps", keymap),
+            os.path.join(root, "scripts", "bench", "autocorrect.c"),
+            os.path.join(root, "users", "daedric", "autocorrect_trie.c"),
+            "-o",
+            out,
+        ],
+        check=True,
+    )
+
+
+def words_of(codes: bytes) -> tuple[list[int], list[int]]:
+    """Start and end of the runs of letters."""
+    starts, ends = [], []
+    start = None
+    for i, code in enumerate(codes + bytes([BOUNDARY])):
+        if code > BOUNDARY and start is None:
+            start = i
+        elif code <= BOUNDARY and start is not None:
+            starts.append(start)
+            ends.append(i)
+            start = None
+    return starts, ends
+
+
+if __name__ == "__main__":
+    args = parser.parse_args()
+    root = os.path.dirname(os.path.dirname(os.path.realpath(__file__)))
+
+    with open(args.corpus, encoding="utf-8") as f:
+        text = f.read().lower()
+    codes = bytes(char_code(c) for c in text)
+
+    with tempfile.TemporaryDirectory() as tmp:
+        bench = os.path.join(tmp, "autocorrect")
+        build(root, args.keymap, bench)
+        trie = list(LAYER_DICTIONARIES).index(args.layer)
+        result = subprocess.run(
+            [bench, str(trie), str(args.runs)],
+            input=codes,
+            capture_output=True,
+            check=True,
+        )
+
+    stats = {}
+    corrections = []
+    for line in result.stdout.decode().splitlines():
+        key, value = line.split()
+        if key == "correction":
+            corrections.append(int(value))
+        else:
+            stats[key] = float(value)
+
+    words = None
+    if args.words:
+        with open(args.words, encoding="utf-8") as f:
+            words = {w.strip().lower() for w in f if w.strip()}
+
+    # A correction fired by a boundary is for the word before it
+    starts, ends = words_of(codes)
+    false_positives = collections.Counter()
+    for i in corrections:
+        w = bisect.bisect_right(starts, i) - 1
+        word = text[starts[w] : ends[w]] if w >= 0 else ""
+        if words is None or word in words:
+            false_positives[word] += 1
+
+    keystrokes = stats["keystrokes"]
+    if not keystrokes:
+        sys.exit(f"{args.corpus}: nothing to replay")
+    print(f"{args.keymap} {args.layer}: {int(keystrokes)} keystrokes")
+    print(f"  {stats['ns'] / keystrokes:.1f} ns per keystroke")
+    print(
+        f"  {stats['reads'] / keystrokes:.2f} trie bytes read per keystroke,"
+        f" {int(stats['max_reads'])} at most"
+    )
+    print(f"  {len(corrections)} corrections")
+    print(f"  {sum(false_positives.values())} false positives")
+    for word, count in false_positives.most_common(10):
+        print(f"    {count} {word}")
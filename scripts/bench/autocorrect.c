@@ -0,0 +1,103 @@
+// Replay keystrokes through the autocorrect lookup of the firmware, see
+// scripts/autocorrect_bench.py
+//
+// Reads the characters, codes of the autocorrect alphabet, from stdin. Prints
+// the timing and trie reads, then the index of the keystrokes which fired a
+// correction.
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "quantum.h"
+#include "autocorrect_trie.h"
+
+uint64_t bench_reads = 0;
+
+static bool      recording         = false;
+static uint32_t  keystroke         = 0;
+static uint32_t *corrections       = NULL;
+static uint32_t  corrections_count = 0;
+static uint32_t  corrections_size  = 0;
+
+void autocorrect_apply_user(uint8_t backspaces, const uint8_t *correction) {
+    if (!recording) {
+        return;
+    }
+    if (corrections_count == corrections_size) {
+        corrections_size = corrections_size ? corrections_size * 2 : 1024;
+        corrections      = realloc(corrections, corrections_size * sizeof(*corrections));
+    }
+    corrections[corrections_count++] = keystroke;
+}
+
+static uint8_t *read_input(size_t *size) {
+    size_t   capacity = 1 << 20;
+    uint8_t *data     = malloc(capacity);
+    size_t   n;
+    *size = 0;
+    while ((n = fread(data + *size, 1, capacity - *size, stdin)) > 0) {
+        *size += n;
+        if (*size == capacity) {
+            capacity *= 2;
+            data = realloc(data, capacity);
+        }
+    }
+    return data;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s TRIE RUNS < codes\n", argv[0]);
+        return 1;
+    }
+    const uint8_t trie = atoi(argv[1]);
+    const int     runs = atoi(argv[2]);
+
+    size_t   size;
+    uint8_t *codes = read_input(&size);
+
+    // Timing, best of the runs
+    double best = 0;
+    for (int run = 0; run < runs; run++) {
+        autocorrect_select(AUTOCORRECT_NO_TRIE);
+        autocorrect_select(trie);
+        const double start = now_ns();
+        for (size_t i = 0; i < size; i++) {
+            autocorrect_type(codes[i]);
+        }
+        const double elapsed = now_ns() - start;
+        if (run == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    // Counting
+    uint64_t max_reads = 0;
+    autocorrect_select(AUTOCORRECT_NO_TRIE);
+    autocorrect_select(trie);
+    bench_reads = 0;
+    recording   = true;
+    for (size_t i = 0; i < size; i++) {
+        const uint64_t before = bench_reads;
+        keystroke             = i;
+        autocorrect_type(codes[i]);
+        if (bench_reads - before > max_reads) {
+            max_reads = bench_reads - before;
+        }
+    }
+
+    printf("keystrokes %zu\n", size);
+    printf("ns %.0f\n", best);
+    printf("reads %llu\n", (unsigned long long)bench_reads);
+    printf("max_reads %llu\n", (unsigned long long)max_reads);
+    for (uint32_t i = 0; i < corrections_count; i++) {
+        printf("correction %u\n", corrections[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,19 @@
+// Host stand-in of quantum.h for users/daedric/autocorrect_trie.c, see
+// scripts/autocorrect_bench.py
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// Every byte of the trie read by the lookup
+extern uint64_t bench_reads;
+
+#define PROGMEM
+#define pgm_read_byte(p) (bench_reads++, *(const uint8_t *)(p))
+
+typedef struct keyrecord_t keyrecord_t;
+
+static inline bool autocorrect_is_enabled(void) {
+    return true;
+}
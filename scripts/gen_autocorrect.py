@@ -0,0 +1,336 @@
+"""Generate the autocorrect tries of every keymap from shared dictionaries.
+
+A trie has the format of QMK's `qmk generate-autocorrect-data`, which needs
+a keyboard and keymap it can find and compiles a single dictionary per call.
+Here the dictionaries are shared and the `autocorrect_data.h` of every build
+target of `qmk.json` with AUTOCORRECT_ENABLE is written at once.
+
+There is one trie per layer in LAYER_DICTIONARIES, the keymap selects the one
+of the layer it was moved to, so typing in english on Qwerty does not go
+through the french typos.
+
+Keys are not QMK keycodes but characters of ALPHABET, which has the accented
+letters typed with the dead key. The keymap generated by gen_keymap.py maps its
+keys, custom keycodes and unicode characters to them, and the lookup is
+users/daedric/autocorrect_trie.c.
+
+Typos are matched from the last typed key, walking back in the trie. For every
+keymap the script reports the size of the trie, the longest typo and the most
+keys compared by the firmware for one keystroke, and fails when the trie goes
+over the flash budget.
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+parser = argparse.ArgumentParser(description="Generate the autocorrect tries.")
+parser.add_argument(
+    "--dictionaries",
+    default="users/daedric/autocorrect",
+    help="Directory of the dictionaries, `typo -> correction` per line",
+)
+parser.add_argument(
+    "--budget",
+    type=int,
+    default=512,
+    help="Flash bytes the tries of a keymap may use",
+)
+parser.add_argument(
+    "--check",
+    action="store_true",
+    default=False,
+    help="Only report, without writing the headers",
+)
+
+# Dictionaries of the tries, by layer name
+LAYER_DICTIONARIES = {
+    "Base": ["english.txt", "french.txt"],
+    "Qwerty": ["english.txt"],
+}
+
+# Codes are the index + 1, 0 ends the lists of the trie and is any other key
+# for the firmware. ':' is a word boundary, like in QMK. They must stay below 64,
+# which flags the branches.
+ALPHABET = ":'abcdefghijklmnopqrstuvwxyzàâæçéèêëîïôœùûüÿ"
+
+# Backspaces are stored in 6 bits of the leaf byte
+MAX_BACKSPACES = 63
+
+header_tpl = """// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Generated by scripts/gen_autocorrect.py from {dictionaries}
+
+#pragma once
+
+{entries}
+
+#define AUTOCORRECT_MIN_LENGTH {min_length} // "{min_typo}"
+#define AUTOCORRECT_MAX_LENGTH {max_length} // "{max_typo}"
+#define DICTIONARY_SIZE {size}
+#define AUTOCORRECT_TRIES {tries}
+
+// Start of every trie in autocorrect_data, then its end: {layers}
+static const uint16_t autocorrect_tries[AUTOCORRECT_TRIES + 1] = {{{offsets}}};
+
+// QMK's autocorrect walks the first one, when it is not turned off
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {{
+{data}
+}};
+"""
+
+
+def parse_dictionaries(paths: list[str]) -> list[tuple[str, str]]:
+    """Typos, with spaces as ':' for word boundaries, and their corrections."""
+    autocorrections = []
+    typos = set()
+    for path in paths:
+        autocorrections += parse_dictionary(path, typos)
+    return autocorrections
+
+
+def parse_dictionary(path: str, typos: set[str]) -> list[tuple[str, str]]:
+    autocorrections = []
+    with open(path, encoding="utf-8") as f:
+        for line_number, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+
+            where = f"{path}:{line_number}"
+            tokens = [token.strip() for token in line.split("->", 1)]
+            if len(tokens) != 2 or not tokens[0]:
+                sys.exit(f'{where}: expected "typo -> correction"')
+            typo, correction = tokens
+            typo = typo.lower().replace(" ", ":")
+
+            if typo in typos:
+                print(f'{where}: ignoring duplicate typo "{typo}"', file=sys.stderr)
+                continue
+            if not set(typo) <= set(ALPHABET):
+                sys.exit(f'{where}: typo "{typo}" has characters not in {ALPHABET}')
+            if not set(correction.replace(" ", ":")) <= set(ALPHABET):
+                sys.exit(
+                    f'{where}: correction "{correction}" has characters'
+                    f" not in {ALPHABET}"
+                )
+            for other in typos:
+                if typo in other or other in typo:
+                    sys.exit(
+                        f'{where}: "{typo}" and "{other}" overlap, the longer one'
+                        " would never trigger"
+                    )
+
+            autocorrections.append((typo, correction))
+            typos.add(typo)
+    if not autocorrections:
+        sys.exit(f"{path}: no typos")
+    return autocorrections
+
+
+def make_trie(autocorrections: list[tuple[str, str]]) -> dict:
+    """Trie of the reversed typos, leaves are under the "LEAF" key."""
+    trie = {}
+    for typo, correction in autocorrections:
+        node = trie
+        for letter in reversed(typo):
+            node = node.setdefault(letter, {})
+        node["LEAF"] = (typo, correction)
+    return trie
+
+
+def char_code(c: str) -> int:
+    return ALPHABET.index(c) + 1
+
+
+def serialize_trie(trie: dict) -> list[int]:
+    """QMK's encoding, with the codes of ALPHABET for the keys.
+
+    A branch lists its keys with a 16 bits link each, the first key flagged with
+    64. A chain lists keys followed by its single child. A leaf has the
+    backspaces count flagged with 128 and the end of the correction, in codes
+    too since the keymap types it.
+    """
+    table = []
+
+    def traverse(node: dict) -> dict:
+        if "LEAF" in node:
+            typo, correction = node["LEAF"]
+            word_boundary_ending = typo[-1] == ":"
+            typo = typo.strip(":")
+            i = 0
+            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+                i += 1
+            backspaces = len(typo) - i - 1 + word_boundary_ending
+            if not 0 <= backspaces <= MAX_BACKSPACES:
+                sys.exit(f'"{typo}" needs {backspaces} backspaces')
+            codes = [char_code(c) for c in correction[i:].replace(" ", ":")]
+            data = [backspaces | 128] + codes + [0]
+            entry = {"data": data, "links": []}
+            table.append(entry)
+        elif len(node) == 1:
+            chars, node = next(iter(node.items()))
+            while len(node) == 1 and "LEAF" not in node:
+                c, node = next(iter(node.items()))
+                chars += c
+            entry = {"chars": chars}
+            table.append(entry)
+            entry["links"] = [traverse(node)]
+        else:
+            entry = {"chars": "".join(sorted(node))}
+            table.append(entry)
+            entry["links"] = [traverse(node[c]) for c in entry["chars"]]
+        return entry
+
+    def serialize(entry: dict) -> list[int]:
+        if not entry["links"]:
+            return entry["data"]
+        if len(entry["links"]) == 1:
+            return [char_code(c) for c in entry["chars"]] + [0]
+        data = []
+        for c, link in zip(entry["chars"], entry["links"]):
+            # Sizes don't depend on the links, computed before the offsets
+            offset = link.get("offset", 0)
+            code = char_code(c) | (0 if data else 64)
+            data += [code, offset & 0xFF, offset >> 8]
+        return data + [0]
+
+    traverse(trie)
+    offset = 0
+    for entry in table:
+        entry["offset"] = offset
+        offset += len(serialize(entry))
+    if offset > 0xFFFF:
+        sys.exit("the trie does not fit the 16 bits links")
+    return [b for entry in table for b in serialize(entry)]
+
+
+def worst_visits(node: dict) -> int:
+    """Most keys the firmware compares walking back from one keystroke.
+
+    A branch is scanned until its key is found, all of them on a miss, a chain
+    compares its keys one by one and a leaf ends the walk.
+    """
+    if "LEAF" in node:
+        return 0
+    if len(node) == 1:
+        chars = 1
+        node = next(iter(node.values()))
+        while len(node) == 1 and "LEAF" not in node:
+            chars += 1
+            node = next(iter(node.values()))
+        return chars + worst_visits(node)
+    return max(
+        [len(node)]
+        + [i + worst_visits(node[c]) for i, c in enumerate(sorted(node), 1)]
+    )
+
+
+def autocorrect_targets(root: str) -> list[str]:
+    """Keymap directories of the build targets with autocorrect."""
+    with open(os.path.join(root, "qmk.json")) as f:
+        targets = json.load(f)["build_targets"]
+    keymaps = []
+    for keyboard, keymap in targets:
+        path = os.path.join(root, "keyboards", keyboard, "keymaps", keymap)
+        with open(os.path.join(path, "rules.mk")) as f:
+            if re.search(r"^AUTOCORRECT_ENABLE\s*=\s*yes", f.read(), re.M):
+                keymaps.append(path)
+    return keymaps
+
+
+class Trie:
+    def __init__(self, layer: str, paths: list[str]):
+        self.layer = layer
+        self.autocorrections = parse_dictionaries(paths)
+        trie = make_trie(self.autocorrections)
+        self.data = serialize_trie(trie)
+        self.depth = max(len(typo) for typo, _ in self.autocorrections)
+        self.visits = worst_visits(trie)
+
+    def comment(self) -> str:
+        width = max(len(typo) for typo, _ in self.autocorrections)
+        return "\n".join(
+            [f"// {self.layer} ({len(self.autocorrections)} entries):"]
+            + [
+                f"//   {typo:<{width}} -> {correction}"
+                for typo, correction in self.autocorrections
+            ]
+        )
+
+
+def gen_header(dictionaries: str, tries: list[Trie]) -> str:
+    typos = [typo for trie in tries for typo, _ in trie.autocorrections]
+    min_typo = min(typos, key=len)
+    max_typo = max(typos, key=len)
+    offsets = [0]
+    for trie in tries:
+        offsets.append(offsets[-1] + len(trie.data))
+    data = []
+    for trie in tries:
+        data.append(f"    // {trie.layer}")
+        data += [
+            "    " + ", ".join(f"0x{b:02X}" for b in trie.data[i : i + 16]) + ","
+            for i in range(0, len(trie.data), 16)
+        ]
+    return header_tpl.format(
+        dictionaries=dictionaries,
+        entries="\n\n".join(trie.comment() for trie in tries),
+        min_length=len(min_typo),
+        min_typo=min_typo,
+        max_length=len(max_typo),
+        max_typo=max_typo,
+        size=offsets[-1],
+        tries=len(tries),
+        layers=", ".join(trie.layer for trie in tries),
+        offsets=", ".join(str(offset) for offset in offsets),
+        data="\n".join(data),
+    )
+
+
+def gen_headers(root: str, dictionaries: str, budget: int) -> dict[str, str]:
+    """autocorrect_data.h of every build target with autocorrect, by path.
+
+    Reports the size of the tries and exits when they are over the budget.
+    """
+    tries = [
+        Trie(layer, [os.path.join(root, dictionaries, f) for f in files])
+        for layer, files in LAYER_DICTIONARIES.items()
+    ]
+    size = sum(len(trie.data) for trie in tries)
+
+    headers = {}
+    over_budget = False
+    for path in autocorrect_targets(root):
+        keymap = os.path.relpath(path, root)
+        print(f"{keymap}: {size}/{budget} bytes")
+        for trie in tries:
+            print(
+                f"    {trie.layer}: {len(trie.data)} bytes, depth {trie.depth},"
+                f" {trie.visits} keys compared per keystroke at most"
+            )
+        if size > budget:
+            print(f"{keymap}: over the flash budget", file=sys.stderr)
+            over_budget = True
+            continue
+        headers[os.path.join(path, "autocorrect_data.h")] = gen_header(
+            dictionaries, tries
+        )
+
+    if over_budget:
+        sys.exit(1)
+    return headers
+
+
+if __name__ == "__main__":
+    args = parser.parse_args()
+    root = os.path.dirname(os.path.dirname(os.path.realpath(__file__)))
+
+    headers = gen_headers(root, args.dictionaries, args.budget)
+    if not args.check:
+        for header, data in headers.items():
+            with open(header, "w", encoding="utf-8") as f:
+                f.write(data)
@@ -4,38 +4,48 @@ from dataclasses import dataclass
 import copy
 from enum import Enum
 from typing import Generator
-from unicodedata import name as unicode_name
+from unicodedata import category, name as unicode_name, normalize
 import re
 import argparse
+import string
+
+from gen_autocorrect import ALPHABET, LAYER_DICTIONARIES
 
 
 parser = argparse.ArgumentParser(description="Process keymap options.")
 parser.add_argument(
     "--keymap",
     choices=["std", "daedric", "daedric_34"],
-    default="std",
-    help='Specify the keymap to use. Options are "std" or "daedric".',
+    nargs="+",
+    default=["std"],
+    help='Specify the keymap to use. Options are "std" or "daedric". With several,'
+    " they are all in the firmware and switched at runtime, see users/daedric/variants.h",
 )
 parser.add_argument(
     "--host",
     choices=["us", "fr"],
-    default="us",
-    help="Specify the host on which the keyboard will be plugged",
+    nargs="+",
+    default=["us"],
+    help="Specify the host on which the keyboard will be plugged. With several,"
+    " the keymap is for the first one and CKC_HOST switches between them",
 )
 parser.add_argument(
     "--autoshift",
-    action="store_true",
-    default=False,
-    help="Autoshift support",
+    choices=["std", "daedric", "daedric_34"],
+    nargs="*",
+    default=None,
+    help="Autoshift support, for the given keymaps or all of them",
+)
+parser.add_argument(
+    "--layers-header",
+    default=None,
+    help="Header for config.h with the layer count, the smallest LAYER_STATE_*BIT and the sizes of the tables",
 )
-
-args = parser.parse_args()
 
 
 class Mode(Enum):
     Base = 0
     Qwerty = 1
-    DK = 2
     Sym = 3
 
     SymQwerty = 4
@@ -63,14 +73,15 @@ def is_unicode(kc) -> bool:
 
 
 class LTFunction:
+    _pattern = re.compile(r"^LT\((?P<layer>\w+)\|\s*(?P<keycode>\w+)\)$")
+
     def __init__(self, layer, kc):
         self.layer = layer
         self.kc = kc
 
-    @staticmethod
-    def parse(kc: str):
-        pattern = re.compile(r"^LT\((?P<layer>\w+)\|\s*(?P<keycode>\w+)\)$")
-        if match := pattern.match(kc):
+    @classmethod
+    def parse(cls, kc: str):
+        if match := cls._pattern.match(kc):
             return LTFunction(match.group("layer"), match.group("keycode"))
 
         return None
@@ -124,6 +135,8 @@ class UnaryKCFunction:
         "WIN_T",
     }
 
+    _pattern = re.compile(r"(?P<fn>\w+)\((?P<keycode>\w+)\)")
+
     def __init__(self, fn, kc):
         self.fn = fn
         self.kc = kc
@@ -135,8 +148,7 @@ class UnaryKCFunction:
                 break
         else:
             return None
-        pattern = re.compile(r"(?P<fn>\w+)\((?P<keycode>\w+)\)")
-        match = pattern.match(kc)
+        match = cls._pattern.match(kc)
         return UnaryKCFunction(match.group("fn"), match.group("keycode"))
 
     def __call__(self, kc):
@@ -275,8 +287,6 @@ class Key:
         match m:
             case Mode.Base:
                 kc, skc = self.base, self.shifted
-            case Mode.DK:
-                kc, skc = self.dk_base, self.dk_shifted
             case Mode.Sym:
                 kc, skc = self.sym_base, self.sym_shifted
             case _:
@@ -286,6 +296,10 @@ class Key:
 
         return kc, skc
 
+    def get_dead_key(self):
+        """What the key sends after the dead key, see Gen._gen_sequences."""
+        return self.dk_base, self.dk_shifted
+
     def is_basic(self, m: Mode):
         kc, _ = self.get_kc(m)
         return isinstance(kc, str)
@@ -319,24 +333,64 @@ class Layer:
         self.rows[coord.row][coord.col] = key.kc
         self.max_length = max(self.max_length, len(key))
 
-    def format(self, FMT: str | None):
+    def fill(self, kc: str):
+        """Set the transparent keys to `kc`."""
+        for cols in self.rows:
+            for i, c in enumerate(cols):
+                if is_transparent(c):
+                    cols[i] = kc
+                    self.has_keys = True
+
+    def replace(self, kc: str, new: str):
+        """Set the keys `kc` to `new`."""
+        for cols in self.rows:
+            for i, c in enumerate(cols):
+                if c == kc:
+                    cols[i] = KeyCode(new)
+        self.has_keys = any(not is_transparent(c) for cols in self.rows for c in cols)
+        self.max_length = max(len(c) for cols in self.rows for c in cols)
+
+    def keys(self) -> list[str]:
+        """Keycodes in LAYOUT() order."""
+        return [str(kc) for kc in itertools.chain(*self.rows)]
+
+    def format(self, FMT: str | None, clang_format: bool = True):
         if not FMT:
             return ",\n".join(", ".join(cols) for cols in self.rows)
 
         fmt = "{{:^{}}}".format(self.max_length)
-        kcs = [fmt.format(kc) for kc in itertools.chain(*self.rows)]
+        kcs = [fmt.format(kc) for kc in self.keys()]
+        if not clang_format:
+            return FMT.format(*kcs)
         return f"\n// clang-format off\n{FMT.format(*kcs)}\n// clang-format on\n"
 
 
 class Keymaps:
     TRNS = "_______"
 
-    def __init__(self, fmt_layer: str, nb_keys):
+    def __init__(self, fmt_layer: str, nb_keys, prefix: str = ""):
         self.fmt_layer = fmt_layer
+        # Of the layer names, when the firmware has several keymaps
+        self.prefix = prefix
 
         self.final_layers: dict[Mode, Layer] = {}
         self.transparent_layer = self._parse(fmt_layer.format(*([self.TRNS] * nb_keys)))
 
+    def layer_name(self, m: Mode) -> str:
+        return f"{self.prefix}{m.name}"
+
+    def _layer_refs(self, layout: str) -> str:
+        """Layers in the keycodes of a layout, renamed with the prefix."""
+        if not self.prefix:
+            return layout
+
+        def rename(match):
+            if match.group(2) not in Mode.__members__:
+                return match.group(0)
+            return f"{match.group(1)}{self.layer_name(Mode[match.group(2)])}"
+
+        return re.sub(r"\b((?:LT|MO|TO|TG|TT|OSL|DF|PDF)\(|CKC_LMOVE_)(\w+)", rename, layout)
+
     @classmethod
     def _parse(cls, layout):
         lines: str = layout.split("\n")
@@ -362,12 +416,12 @@ class Keymaps:
         if preset is None:
             l = Layer(self, copy.deepcopy(self.transparent_layer))
         else:
-            l = Layer(self, self._parse(preset))
+            l = Layer(self, self._parse(self._layer_refs(preset)))
         self.final_layers[m] = l
         return l
 
     def set_base(self, layer):
-        self.base_layer = self._parse(layer)
+        self.base_layer = self._parse(self._layer_refs(layer))
 
     def base_keys(self) -> Generator[tuple[KeyCode, Coord], None, None]:
         for row, cols in enumerate(self.base_layer):
@@ -377,8 +431,17 @@ class Keymaps:
     def has_keys(self, m: Mode) -> bool:
         return self.final_layers[m].has_keys
 
-    def format(self, m: Mode) -> str:
-        return self.final_layers[m].format(self.fmt_layer)
+    def format(self, m: Mode, clang_format: bool = True) -> str:
+        return self.final_layers[m].format(self.fmt_layer, clang_format)
+
+    def keys(self, m: Mode) -> list[str]:
+        return self.final_layers[m].keys()
+
+    def format_keys(self, keys: list) -> str:
+        """Any values in the LAYOUT() grid."""
+        width = max(len(str(k)) for k in keys)
+        kcs = [f"{k:>{width}}" for k in keys]
+        return f"\n// clang-format off\n{self.fmt_layer.format(*kcs)}\n// clang-format on\n"
 
 
 ergol_keys = {
@@ -393,7 +456,7 @@ ergol_keys = {
         "EKC_J": Key(base="KC_J", shifted=None, dk_base="KC_TRNS", dk_shifted="KC_TRNS", sym_base="KC_AT", sym_shifted=0x030A),
         "EKC_M": Key(base="KC_M", shifted=None, dk_base=0x00B5, dk_shifted="KC_TRNS", sym_base="KC_AMPR", sym_shifted="KC_TRNS"),
         "EKC_D": Key(base="KC_D", shifted=None, dk_base="KC_UNDS", dk_shifted="KC_TRNS", sym_base="KC_ASTR", sym_shifted=0x00D7),
-        "EKC_DK": Key(base="OSL(DK)", shifted="KC_EXLM", dk_base=0x0308, dk_shifted=0x00A1, sym_base="KC_QUOT", sym_shifted=0x0301),
+        "EKC_DK": Key(base="CKC_DK", shifted="KC_EXLM", dk_base=0x0308, dk_shifted=0x00A1, sym_base="KC_QUOT", sym_shifted=0x0301),
         "EKC_Y": Key(base="KC_Y", shifted=None, dk_base=0x00FB, dk_shifted=0x00DB, sym_base="KC_GRV", sym_shifted=0x0300),
 
         "EKC_A": Key(base="KC_A", shifted=None, dk_base=0x00E0, dk_shifted=0x00C0, sym_base="KC_LCBR", sym_shifted=0x030C),
@@ -446,7 +509,7 @@ ergol_keys = {
         "EKC_J": Key(base="FR_J", shifted=None, dk_base="KC_TRNS", dk_shifted="KC_TRNS", sym_base="FR_AT", sym_shifted=0x030A),
         "EKC_M": Key(base="FR_M", shifted=None, dk_base=0x00B5, dk_shifted="KC_TRNS", sym_base="FR_AMPR", sym_shifted="KC_TRNS"),
         "EKC_D": Key(base="FR_D", shifted=None, dk_base="FR_UNDS", dk_shifted="KC_TRNS", sym_base="FR_ASTR", sym_shifted=0x00D7),
-        "EKC_DK": Key(base="OSL(DK)", shifted="KC_EXLM", dk_base=0x0308, dk_shifted=0x00A1, sym_base="FR_QUOT", sym_shifted=0x0301),
+        "EKC_DK": Key(base="CKC_DK", shifted="KC_EXLM", dk_base=0x0308, dk_shifted=0x00A1, sym_base="FR_QUOT", sym_shifted=0x0301),
         "EKC_Y": Key(base="FR_Y", shifted=None, dk_base=0x00FB, dk_shifted=0x00DB, sym_base="FR_GRV", sym_shifted=0x0300),
 
         "EKC_A": Key(base="FR_A", shifted=None, dk_base="FR_AGRV", dk_shifted=0x00C0, sym_base="FR_LCBR", sym_shifted=0x030C),
@@ -490,6 +553,246 @@ ergol_keys = {
     },
 }
 
+# Compose sequences, keys as named in ergol_keys and prefixed by their layer when
+# not on Base, "DK" being the dead key.
+#
+# Every sequence starts with the dead key, nothing is typed before the last key,
+# which types the uppercase character when shifted. Text typed before the dead
+# key is never replaced.
+compose_sequences = {
+    ("DK", "DK", "EKC_A"): 0x00E4,
+    ("DK", "DK", "EKC_E"): 0x00EB,
+    ("DK", "DK", "EKC_I"): 0x00EF,
+    ("DK", "DK", "EKC_O"): 0x00F6,
+    ("DK", "DK", "EKC_U"): 0x00FC,
+    ("DK", "DK", "EKC_Y"): 0x00FF,
+    ("DK", "Sym.EKC_F", "Sym.EKC_I"): 0x2260,
+}
+
+
+def compose_output(cp: int) -> tuple[int, int]:
+    upper = chr(cp).upper()
+    return cp, ord(upper) if len(upper) == 1 else cp
+
+
+class UnicodeRoutes:
+    """Keys typing a character natively on the host, instead of its hex code.
+
+    Accented letters are found from their decomposition, a dead key followed by
+    the base letter, the other characters are listed in `symbols`. With
+    `compose` the keys are typed after the host compose key.
+    """
+
+    def __init__(
+        self,
+        letter: str,
+        dead_keys: dict[int, str],
+        symbols: dict[int, list[str]],
+        compose=False,
+    ):
+        self.letter = letter
+        self.dead_keys = dead_keys
+        self.symbols = symbols
+        self.compose = compose
+
+    def get(self, cp: int) -> list[str] | None:
+        if keys := self.symbols.get(cp):
+            return keys
+        decomposed = normalize("NFD", chr(cp))
+        if len(decomposed) != 2 or not decomposed[0].isascii():
+            return None
+        base, mark = decomposed
+        dead_key = self.dead_keys.get(ord(mark))
+        if not dead_key or not base.isalpha():
+            return None
+        letter = self.letter.format(base.upper())
+        return [dead_key, f"S({letter})" if base.isupper() else letter]
+
+
+# Sequences of the X11 Compose file, WinCompose uses the same ones
+compose_us = UnicodeRoutes(
+    letter="KC_{}",
+    dead_keys={
+        0x0300: "KC_GRV",
+        0x0301: "KC_QUOT",
+        0x0302: "KC_CIRC",
+        0x0303: "KC_TILD",
+        0x0308: "KC_DQUO",
+        0x0327: "KC_COMM",
+    },
+    symbols={
+        # fmt: off
+        0x00A1: ["KC_EXLM", "KC_EXLM"], 0x00A2: ["KC_C", "KC_SLSH"], 0x00A6: ["KC_EXLM", "KC_CIRC"],
+        0x00A7: ["KC_S", "KC_O"], 0x00AB: ["KC_LABK", "KC_LABK"], 0x00AC: ["KC_COMM", "KC_MINS"],
+        0x00B0: ["KC_O", "KC_O"], 0x00B5: ["KC_M", "KC_U"], 0x00B6: ["S(KC_P)", "KC_EXLM"],
+        0x00B7: ["KC_DOT", "KC_MINS"], 0x00BB: ["KC_RABK", "KC_RABK"], 0x00BF: ["KC_QUES", "KC_QUES"],
+        0x00C6: ["S(KC_A)", "S(KC_E)"], 0x00D7: ["KC_X", "KC_X"], 0x00DF: ["KC_S", "KC_S"],
+        0x00E6: ["KC_A", "KC_E"], 0x00F7: ["KC_COLN", "KC_MINS"], 0x0152: ["S(KC_O)", "S(KC_E)"],
+        0x0153: ["KC_O", "KC_E"], 0x1E9E: ["S(KC_S)", "S(KC_S)"], 0x2013: ["KC_MINS", "KC_MINS", "KC_DOT"],
+        0x2014: ["KC_MINS", "KC_MINS", "KC_MINS"], 0x2018: ["KC_LABK", "KC_QUOT"], 0x2019: ["KC_RABK", "KC_QUOT"],
+        0x201A: ["KC_COMM", "KC_QUOT"], 0x201C: ["KC_LABK", "KC_DQUO"], 0x201D: ["KC_RABK", "KC_DQUO"],
+        0x201E: ["KC_COMM", "KC_DQUO"], 0x2022: ["KC_DOT", "KC_EQL"], 0x2026: ["KC_DOT", "KC_DOT"],
+        0x2030: ["KC_PERC", "KC_O"], 0x20AC: ["KC_EQL", "KC_E"], 0x2260: ["KC_SLSH", "KC_EQL"],
+        0x2264: ["KC_LABK", "KC_EQL"], 0x2265: ["KC_RABK", "KC_EQL"],
+        # fmt: on
+        **{ord(c): ["KC_CIRC", f"KC_{d}"] for d, c in enumerate("⁰¹²³⁴⁵⁶⁷⁸⁹")},
+        **{ord(c): ["KC_UNDS", f"KC_{d}"] for d, c in enumerate("₀₁₂₃₄₅₆₇₈₉")},
+    },
+    compose=True,
+)
+
+# Option sequences of the us layout, shorter than the hex input on a mac. The
+# acute dead key and the cedilla are on E and C, which are hex digits for the
+# Unicode Hex Input layout of the macOS input mode.
+option_us = UnicodeRoutes(
+    letter="KC_{}",
+    dead_keys={
+        0x0300: "LALT(KC_GRV)",
+        0x0301: "LALT(KC_E)",
+        0x0302: "LALT(KC_I)",
+        0x0303: "LALT(KC_N)",
+        0x0308: "LALT(KC_U)",
+    },
+    symbols={
+        # fmt: off
+        0x00AB: ["LALT(KC_BSLS)"], 0x00AC: ["LALT(KC_L)"], 0x00B5: ["LALT(KC_M)"], 0x00BB: ["LSA(KC_BSLS)"],
+        0x00BF: ["LSA(KC_SLSH)"], 0x00C6: ["LSA(KC_QUOT)"], 0x00C7: ["LSA(KC_C)"], 0x00DF: ["LALT(KC_S)"],
+        0x00E6: ["LALT(KC_QUOT)"], 0x00E7: ["LALT(KC_C)"],
+        0x00F7: ["LALT(KC_SLSH)"], 0x0152: ["LSA(KC_Q)"], 0x0153: ["LALT(KC_Q)"], 0x2013: ["LALT(KC_MINS)"],
+        0x2014: ["LSA(KC_MINS)"], 0x2018: ["LALT(KC_RBRC)"], 0x2019: ["LSA(KC_RBRC)"], 0x201C: ["LALT(KC_LBRC)"],
+        0x201D: ["LSA(KC_LBRC)"], 0x201E: ["LSA(KC_W)"], 0x2026: ["LALT(KC_SCLN)"], 0x2030: ["LSA(KC_R)"],
+        0x2260: ["LALT(KC_EQL)"], 0x2264: ["LALT(KC_COMM)"], 0x2265: ["LALT(KC_DOT)"],
+        # fmt: on
+    },
+)
+
+# Keys and dead keys of the french layout
+azerty_fr = UnicodeRoutes(
+    letter="FR_{}",
+    dead_keys={
+        0x0300: "FR_GRV",
+        0x0302: "FR_DCIR",
+        0x0303: "FR_TILD",
+        0x0308: "FR_DIAE",
+    },
+    symbols={
+        # fmt: off
+        0x005E: ["FR_CIRC"], 0x00A7: ["FR_SECT"], 0x00B0: ["FR_DEG"], 0x00B2: ["FR_SUP2"], 0x00B5: ["FR_MICR"],
+        0x00E0: ["FR_AGRV"], 0x00E7: ["FR_CCED"], 0x00E8: ["FR_EGRV"], 0x00E9: ["FR_EACU"], 0x00F9: ["FR_UGRV"],
+        0x20AC: ["FR_EURO"],
+        # fmt: on
+    },
+)
+
+unicode_modes = [
+    "UNICODE_MODE_MACOS",
+    "UNICODE_MODE_LINUX",
+    "UNICODE_MODE_WINDOWS",
+    "UNICODE_MODE_BSD",
+    "UNICODE_MODE_WINCOMPOSE",
+    "UNICODE_MODE_EMACS",
+]
+
+# Native routes per host and input mode. The french layout is not there on
+# macOS, where the input mode needs the Unicode Hex Input layout.
+unicode_routes = {
+    "us": {
+        "UNICODE_MODE_MACOS": option_us,
+        "UNICODE_MODE_LINUX": compose_us,
+        "UNICODE_MODE_WINCOMPOSE": compose_us,
+    },
+    "fr": {m: azerty_fr for m in unicode_modes if m != "UNICODE_MODE_MACOS"},
+}
+
+
+# Characters of the basic keys of the us layout, unshifted and shifted, in
+# keycode order
+us_chars = {
+    **{f"KC_{c.upper()}": c + c.upper() for c in string.ascii_lowercase},
+    **{f"KC_{d}": d + s for d, s in zip("1234567890", "!@#$%^&*()")},
+    # fmt: off
+    "KC_MINS": "-_", "KC_EQL": "=+", "KC_LBRC": "[{", "KC_RBRC": "]}", "KC_BSLS": "\\|",
+    "KC_SCLN": ";:", "KC_QUOT": "'\"", "KC_GRV": "`~", "KC_COMM": ",<", "KC_DOT": ".>",
+    "KC_SLSH": "/?",
+    # fmt: on
+}
+
+# Keys of the characters on the other hosts, for the translation of a keymap
+# written for the us layout. ` and ~ are dead keys on the french layout, like in
+# the keymap generated for it.
+host_chars = {
+    "fr": {
+        **{c: f"FR_{c.upper()}" for c in string.ascii_lowercase},
+        **{c: f"S(FR_{c})" for c in string.ascii_uppercase},
+        **{d: f"FR_{d}" for d in string.digits},
+        # fmt: off
+        "!": "FR_EXLM", '"': "FR_DQUO", "#": "FR_HASH", "$": "FR_DLR", "%": "FR_PERC",
+        "&": "FR_AMPR", "'": "FR_QUOT", "(": "FR_LPRN", ")": "FR_RPRN", "*": "FR_ASTR",
+        "+": "FR_PLUS", ",": "FR_COMM", "-": "FR_MINS", ".": "FR_DOT", "/": "FR_SLSH",
+        ":": "FR_COLN", ";": "FR_SCLN", "<": "FR_LABK", "=": "FR_EQL", ">": "FR_RABK",
+        "?": "FR_QUES", "@": "FR_AT", "[": "FR_LBRC", "\\": "FR_BSLS", "]": "FR_RBRC",
+        "^": "FR_CIRC", "_": "FR_UNDS", "`": "FR_GRV", "{": "FR_LCBR", "|": "FR_PIPE",
+        "}": "FR_RCBR", "~": "FR_TILD",
+        # fmt: on
+    },
+}
+
+# Characters of the keycodes of the french layout
+native_chars = {
+    kcs[0]: chr(cp) for cp, kcs in azerty_fr.symbols.items() if len(kcs) == 1
+}
+
+# Keys ending a word for autocorrect, without their KC_/FR_ prefix
+autocorrect_boundaries = {
+    # fmt: off
+    "SPC", "ENT", "TAB", "1", "2", "3", "4", "5", "6", "7", "8", "9", "0",
+    "DOT", "COMM", "SCLN", "COLN", "EXLM", "QUES", "MINS", "UNDS", "SLSH", "BSLS",
+    "LPRN", "RPRN", "LBRC", "RBRC", "LCBR", "RCBR", "LABK", "RABK", "DQUO", "EQL",
+    "PLUS", "ASTR", "AMPR", "AT", "HASH", "DLR", "PERC", "CIRC", "GRV", "TILD", "PIPE",
+    # fmt: on
+}
+
+
+def autocorrect_char(kc: KeyCode) -> str | None:
+    """Character of the autocorrect ALPHABET typed by a key, ':' for a word
+    boundary and None for the keys which are not part of a word."""
+    if kc.is_unicode:
+        c = chr(kc.raw_keycode).lower()
+        if c == "’":
+            return "'"
+        if c in ALPHABET:
+            return c
+        return ":" if category(c)[0] in "PZ" else None
+    if kc.raw_keycode in native_chars:
+        return autocorrect_char(KeyCode(ord(native_chars[kc.raw_keycode])))
+    name = re.sub(r"^(KC|FR)_", "", str(kc.raw_keycode))
+    if len(name) == 1 and name.isalpha():
+        return name.lower()
+    if name == "QUOT":
+        return "'"
+    return ":" if name in autocorrect_boundaries else None
+
+
+# Taps fitting in the UNICODE_OPS_SIZE ops of the unicode queue
+UNICODE_ROUTE_MAX_TAPS = 12
+
+
+def unicode_hex_taps(cp: int, mode: str) -> int | None:
+    """Keys tapped by unicode_ops_build() for a code point, None if it can't."""
+    digits = len(f"{cp:x}")
+    match mode:
+        case "UNICODE_MODE_MACOS":
+            return 1 + (8 if cp > 0xFFFF else digits)
+        case "UNICODE_MODE_LINUX":
+            return 1 + digits + 1
+        case "UNICODE_MODE_WINDOWS":
+            return None if cp > 0xFFFF else 2 + digits
+        case "UNICODE_MODE_WINCOMPOSE":
+            return 2 + (f"{cp:x}"[0] > "9") + digits + 1
+        case "UNICODE_MODE_EMACS":
+            return 3 + digits + 1
+    return None
+
 
 class Gen:
     file_tpl = """
@@ -502,38 +805,87 @@ class Gen:
 
         {extra_include}
 
+        #include "custom_keys.h"
+        #include "hosts.h"
+        #include "sequences.h"
+        #include "sparse_keymap.h"
+        #include "unicode_queue.h"
+
     enum layers {{
         {layers},
     }};
 
+    // LAYER_COUNT, the width of layer_state_t and the sizes of the tables read
+    // by users/daedric come from layers.h
+    _Static_assert({last_layer} + 1 == LAYER_COUNT, "layers.h is out of date");
+    _Static_assert(LAYER_COUNT <= sizeof(layer_state_t) * 8, "layer_state_t is too small for the layers");
+
+    {variants}
+
     enum custom_keycodes {{
-        _FIRST = SAFE_RANGE,
         {custom_keycodes},
     }};
 
+    _Static_assert({last_custom_keycode} - KEYMAP_SAFE_RANGE + 1 == CUSTOM_KEY_COUNT, "layers.h is out of date");
+
     {aliases}
 
     {unicode_map}
 
+    {unicode_routes}
+
+    {hosts}
+
     {overrides}
 
 
-    const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {{
-        {layouts},
-    }};
+    {keymap}
 
-    {custom_process}
-    {custom_autoshift}
+    {sequences}
+    {custom_keys}
     """
 
-    def __init__(self, host, kms: "Keymaps", autoshift=False):
-        self.host = host
-        self.keymaps = kms
-        self.autoshift = autoshift
+    keymap_tpl = """
+// Only the keys which are not KC_TRNS are stored, in LAYOUT() order, see
+// users/daedric/sparse_keymap.h:
+/*
+{layouts},
+*/
+
+const uint8_t PROGMEM keymap_positions[MATRIX_ROWS][MATRIX_COLS] = LAYOUT({positions});
+
+const keymap_layer_t PROGMEM keymap_layers[LAYER_COUNT] = {{
+    {layers},
+}};
+
+// {stored} of the {total} keys
+const uint16_t PROGMEM keymap_keycodes[] = {{
+    {keycodes}
+}};
+
+// Unused, QMK needs it but the layers are read through sparse_keymap.c which
+// overrides keymap_layer_count() and keycode_at_keymap_location()
+const uint16_t PROGMEM keymaps[1][MATRIX_ROWS][MATRIX_COLS] = {{{{{{KC_NO}}}}}};
+"""
+
+    def __init__(self, hosts: list[str], variants: dict[str, "Keymaps"], autoshift: list[str]):
+        # The keymap is written for the first host, the keys of the others are
+        # translated at runtime
+        self.hosts = hosts
+        self.host = hosts[0]
+        # Keymaps in the firmware, the ones with autoshift turn it on when
+        # they are selected
+        self.variants = variants
+        self.autoshift_variants = autoshift
+        self.autoshift = bool(autoshift)
         self.keys = ergol_keys[self.host]
         self.unicode_to_idx: dict[KeyCode, str] = {}
         self.unicode_map: str | None = None
-        self.override: dict[Mode, dict[str, Override]] = defaultdict(dict)
+        self.unicode_codepoints: dict[str, int] = {}
+        self.unicode_indices: dict[str, int] = {}
+        self.layer_keycodes: dict[Mode, dict[str, str]] = defaultdict(dict)
+        # By layer name, the keys of a mode can differ between the keymaps
+        self.override: dict[str, dict[str, Override]] = defaultdict(dict)
         self.aliases: dict[str, KeyCode] = {}
         self.custom_keys: dict[Mode, dict[str, tuple[KeyCode, KeyCode]]] = defaultdict(
             dict
@@ -545,83 +897,199 @@ class Gen:
         for _, k in self.keys.items():
             if not k.is_basic(Mode.Base):
                 raise Exception("At the moment base keymaps need to be basic")
+        if len(self.hosts) > 1 and self.host != "us":
+            raise Exception("the other hosts are translated from the us layout")
 
     def _gen_unicode_map(self):
-        indices_line = "{idx}"
+        """unicode_map and its entries, typed by users/daedric/unicode_queue.c."""
         unicode_map_line = "[{idx}]  = {cp:#06x} /* {dsp} */"
+        astral_line = "[{idx} - UNICODE_MAP_ASTRAL_FIRST]  = {cp:#07x} /* {dsp} */"
         tpl = """
             enum unicode_names {{
                 {indices},
             }};
 
+            _Static_assert({last} + 1 == UNICODE_MAP_COUNT, "layers.h is out of date");
 
-            const uint32_t PROGMEM unicode_map[] = {{
+            const uint16_t PROGMEM unicode_map[] = {{
                 {unicode_map_lines},
             }};
+            {unicode_map_astral}
+        """
+        astral_tpl = """
+            _Static_assert({first} == UNICODE_MAP_ASTRAL_FIRST, "layers.h is out of date");
+
+            const uint32_t PROGMEM unicode_map_astral[] = {{
+                {lines},
+            }};
         """
-        indices = []
-        unicode_map_lines = []
+        entries = []
         already_gen = set()
+        pairs = []
         for _, key in self.keys.items():
-            for m in Mode:
-                kc, skc = key.get_kc(m)
-                kc = KeyCode(kc)
-                skc = KeyCode(skc)
-                for k in (kc, skc):
-                    if k.is_unicode:
-                        if k in already_gen:
-                            continue
-                        already_gen.add(k)
-
-                        ch = chr(k.raw_keycode)
-                        name = unicode_name(ch)
-                        name = name.replace(" ", "_").replace("-", "_")
-
-                        idx = indices_line.format(idx=name)
-                        self.unicode_to_idx[k] = idx
-                        ln = unicode_map_line.format(idx=idx, cp=k, dsp=ch)
-                        indices.append(idx)
-                        unicode_map_lines.append(ln)
+            pairs += [key.get_kc(m) for m in Mode] + [key.get_dead_key()]
+        pairs += [compose_output(cp) for cp in compose_sequences.values()]
+        for kc, skc in pairs:
+            kc = KeyCode(kc)
+            skc = KeyCode(skc)
+            for k in (kc, skc):
+                if k.is_unicode:
+                    if k in already_gen:
+                        continue
+                    already_gen.add(k)
+
+                    ch = chr(k.raw_keycode)
+                    name = unicode_name(ch)
+                    name = name.replace(" ", "_").replace("-", "_")
+
+                    self.unicode_to_idx[k] = name
+                    entries.append((name, k))
+
+        # Code points above the BMP go last, in their own 32 bits table
+        entries.sort(key=lambda e: e[1].raw_keycode > 0xFFFF)
+        bmp = [(n, k) for n, k in entries if k.raw_keycode <= 0xFFFF]
+        astral = entries[len(bmp) :]
+        for i, (name, k) in enumerate(entries):
+            self.unicode_codepoints[name] = k.raw_keycode
+            self.unicode_indices[name] = i
+
+        self.unicode_astral_first = len(bmp) if astral else None
         self.unicode_map = tpl.format(
-            indices=",\n".join(indices),
-            unicode_map_lines=",\n".join(unicode_map_lines),
+            indices=",\n".join(n for n, _ in entries),
+            last=entries[-1][0],
+            unicode_map_lines=",\n".join(
+                unicode_map_line.format(idx=n, cp=k, dsp=chr(k.raw_keycode))
+                for n, k in bmp
+            ),
+            unicode_map_astral=astral
+            and astral_tpl.format(
+                first=astral[0][0],
+                lines=",\n".join(
+                    astral_line.format(idx=n, cp=k, dsp=chr(k.raw_keycode))
+                    for n, k in astral
+                ),
+            )
+            or "",
         )
 
-    def _create_override(self, m: Mode, name, kc: KeyCode, skc: KeyCode):
+    def _gen_unicode_routes(self):
+        """Native keys of the unicode_map entries, see users/daedric/unicode_queue.h."""
+        route_line = "[{mode}] = {{{offset}, {length}}}"
+        tpl = """
+            const uint16_t PROGMEM unicode_route_keys[] = {{
+                {keys}
+            }};
+
+            const unicode_route_t PROGMEM unicode_routes[UNICODE_ROUTE_COUNT][UNICODE_MODE_COUNT] = {{
+                {routes}
+            }};
+        """
+        keys = []
+        routes = []
+        offset = 0
+        offsets: dict[tuple[str, ...], int] = {}
+        self.unicode_route_count = 1
+        for idx, cp in self.unicode_codepoints.items():
+            mode_routes = []
+            for mode, source in unicode_routes[self.host].items():
+                route = source.get(cp)
+                if not route:
+                    continue
+                taps = len(route) + source.compose
+                hex_taps = unicode_hex_taps(cp, mode)
+                if hex_taps is not None and hex_taps <= taps:
+                    continue
+                if taps > UNICODE_ROUTE_MAX_TAPS:
+                    raise Exception(f"route too long for unicode_ops: {route}")
+                if (route := tuple(route)) not in offsets:
+                    offsets[route] = offset
+                    keys.append((f"{', '.join(route)},", chr(cp)))
+                    offset += len(route)
+                length = len(route)
+                if source.compose:
+                    length = f"{length} | UNICODE_ROUTE_COMPOSE"
+                mode_routes.append(
+                    route_line.format(mode=mode, offset=offsets[route], length=length)
+                )
+            if mode_routes:
+                routes.append(f"[{idx}] = {{{', '.join(mode_routes)}}}")
+                # Up to the last entry with a route
+                self.unicode_route_count = self.unicode_indices[idx] + 1
+        width = max((len(k) for k, _ in keys), default=0)
+        self.unicode_routes = tpl.format(
+            keys="\n".join(f"{k:<{width}} // {ch}" for k, ch in keys),
+            routes=",\n".join(routes),
+        )
+
+    def _gen_hosts(self):
+        """Keys of the characters of the keymap on the other hosts, see users/daedric/hosts.h."""
+        if len(self.hosts) == 1:
+            self.hosts_code = ""
+            return
+
+        tpl = """
+const uint16_t PROGMEM host_keys[HOST_COUNT - 1][HOST_KEY_LAST - HOST_KEY_FIRST + 1][2] = {{
+    {tables}
+}};
+"""
+        tables = []
+        for host in self.hosts[1:]:
+            keys = host_chars[host]
+            entries = [
+                f"[{kc} - HOST_KEY_FIRST] = {{{keys[chars[0]]}, {keys[chars[1]]}}}"
+                for kc, chars in us_chars.items()
+            ]
+            tables.append(f"// {host}\n{{\n" + ",\n".join(entries) + ",\n}")
+        self.hosts_code = tpl.format(tables=",\n".join(tables) + ",")
+
+    def _create_override(self, m: Mode, layer: str, name, kc: KeyCode, skc: KeyCode):
         if skc.is_unicode:
             skc = KeyCode(f"UM({self.unicode_to_idx[skc]})")
         if skc.is_transparent:
             skc = kc
         ovr = Override(m=m, n=name, kc=kc, skc=skc)
-        self.override[m][name] = ovr
+        self.override[layer][name] = ovr
         return ovr
 
     def _gen_override(self):
-        override_line = "const key_override_t {name} = ko_make_with_layers(MOD_MASK_SHIFT, {key}, {skey}, (1 << {mode}));"
+        """Shifted keys of the shift engine, see users/daedric/custom_keys.h."""
+        shift_key_line = "{{{key}, {skey}}},"
+        shift_layer_line = "[{mode}] = {{{offset}, {count}}}"
         tpl = """
-        {overrides}
+        const shift_key_t PROGMEM shift_keys[] = {{
+            {overrides}
+        }};
 
-        const key_override_t *key_overrides[] = (const key_override_t *[]){{
-            {override_names},
-            NULL,
+        const shift_layer_t PROGMEM shift_layers[LAYER_COUNT] = {{
+            {layers},
         }};
         """
         overrides = []
-        override_names = []
-        for m, override_per_kc in self.override.items():
-            for _, override in override_per_kc.items():
-                overrides.append(
-                    override_line.format(
-                        name=override.name,
-                        key=override.kc,
-                        skey=override.skc,
-                        mode=m.name,
-                    )
+        layers = []
+        offset = 0
+        # The layers with the same keys, in the keymaps of the firmware, share
+        # their entries
+        offsets: dict[tuple[str, ...], int] = {}
+        for layer, override_per_kc in self.override.items():
+            lines = tuple(
+                shift_key_line.format(key=override.kc, skey=override.skc)
+                for override in override_per_kc.values()
+            )
+            if lines not in offsets:
+                offsets[lines] = offset
+                overrides.append(f"// {layer}")
+                overrides.extend(lines)
+                offset += len(lines)
+            layers.append(
+                shift_layer_line.format(
+                    mode=layer, offset=offsets[lines], count=len(lines)
                 )
-                override_names.append(f"&{override.name}")
+            )
+        if offset > 0xFF:
+            raise Exception("too many shifted keys for the 8 bits offsets of shift_layers")
         self.override_code = tpl.format(
             overrides="\n".join(overrides),
-            override_names=",\n".join(override_names),
+            layers=",\n".join(layers),
         )
 
     def _create_custom_key(self, m: Mode, name, kc: KeyCode, skc: KeyCode):
@@ -636,211 +1104,221 @@ class Gen:
         self.custom_keys[m][custom_key_name] = (kc, skc)
         return KeyCode(custom_key_name)
 
-    def _gen_custom_keys(self):
-        custom_process_tpl = """
-bool process_record_user(uint16_t keycode, keyrecord_t *record) {{
-        const bool key_pressed = record->event.pressed;
-        const bool shifted = (get_mods() & MOD_MASK_SHIFT) != 0;
-        uint16_t kc;
-        uint8_t skc_idx;
-        switch (keycode) {{
-        default:
-            return true;
-        {cases}
-        }}
-
-        if (shifted) {{
-            if (key_pressed) {{
-                uint8_t temp_mod = get_mods();
-                clear_mods();
-                uint32_t skc = unicodemap_get_code_point(skc_idx);
-                register_unicode(skc);
-                set_mods(temp_mod);
-                return false;
-            }}
-        }} else {{
-            if (key_pressed) {{
-                register_code16(kc);
-            }} else {{
-                unregister_code16(kc);
-            }}
-        }}
-
-    return true;
-}}
-        """
-        custom_keycode_process_tpl = """
-            case {name}:
-                kc = {kc};
-                skc_idx = {skc_name};
-                break;
-        """
-        custom_keycode_layer_move_tpl = """
-            case {name}:
-                layer_move({layer});
-                return false;
-                break;
-        """
-
-        self.custom_keycodes = []
-        self.cases = []
+    def _sequence_output(self, kc, skc) -> tuple[str, str]:
+        kc, skc = KeyCode(kc), KeyCode(skc)
+        if skc.is_transparent:
+            skc = kc
+        return tuple(
+            f"UM({self.unicode_to_idx[k]})" if k.is_unicode else str(k)
+            for k in (kc, skc)
+        )
 
-        for m in Mode:
-            if not self.keymaps.has_keys(m):
-                continue
-            ckc_name = f"CKC_LMOVE_{m.name}"
-            self.custom_keycodes.append(ckc_name)
-            self.cases.append(
-                custom_keycode_layer_move_tpl.format(name=ckc_name, layer=m.name)
+    def _sequence_typed(self, kc: str) -> tuple[str, str]:
+        """What a key of a sequence types, the custom keys send their keycode."""
+        for ckcs in self.custom_keys.values():
+            if kc in ckcs:
+                return self._sequence_output(ckcs[kc][0], ckcs[kc][0])
+        return kc, kc
+
+    def _sequence_key(self, ref: str) -> str | None:
+        if ref == "DK":
+            return "CKC_DK"
+        layer, _, name = ref.rpartition(".")
+        return self.layer_keycodes[Mode[layer or "Base"]].get(name)
+
+    def _gen_autocorrect(self):
+        """Characters of the keys for autocorrect, see users/daedric/sequences.h."""
+        tpl = """
+#ifdef AUTOCORRECT_ENABLE
+#    include "autocorrect_trie.h"
+
+const uint8_t PROGMEM autocorrect_unicode[UNICODE_MAP_COUNT] = {{
+    {unicode},
+}};
+
+const autocorrect_key_t PROGMEM autocorrect_keys[] = {{
+    {keys}
+    {{KC_NO, AUTOCORRECT_NONE}},
+}};
+
+const uint16_t PROGMEM autocorrect_keycodes[] = {{
+    {keycodes},
+}};
+
+const uint8_t PROGMEM autocorrect_layer_tries[LAYER_COUNT] = {{
+    {layer_tries},
+}};
+#endif
+"""
+        letter = "FR_{}" if self.host == "fr" else "KC_{}"
+        chars: dict[str, str] = {}
+        for c in "abcdefghijklmnopqrstuvwxyz":
+            chars[letter.format(c.upper())] = c
+        chars[letter.format("QUOT")] = "'"
+        for kc, name in self.unicode_to_idx.items():
+            if c := autocorrect_char(kc):
+                chars[f"UM({name})"] = c
+        # The custom keys are looked up with the keycode they send
+        for m, keycodes in self.layer_keycodes.items():
+            for name in keycodes:
+                kc = KeyCode(self.keys[name].get_kc(m)[0])
+                if kc.is_transparent or kc.is_unicode:
+                    continue
+                if c := autocorrect_char(kc):
+                    chars.setdefault(str(kc), c)
+        for key in self.keys.values():
+            for kc in key.get_dead_key():
+                if isinstance(kc, str) and (c := autocorrect_char(KeyCode(kc))):
+                    chars.setdefault(kc, c)
+        # The shifted dead key is a punctuation
+        for kc in ("KC_SPC", "KC_ENT", "KC_TAB", "CKC_DK"):
+            chars.setdefault(kc, ":")
+
+        def code(c):
+            return "AUTOCORRECT_BOUNDARY" if c == ":" else ALPHABET.index(c) + 1
+
+        unicode = [
+            f"[{kc[3:-1]}] = {code(c)} /* {c} */"
+            for kc, c in chars.items()
+            if kc.startswith("UM(")
+        ]
+        # The characters of the words first, they are most of the typed keys
+        keys = [
+            f"{{{kc}, {code(c)}}}, // {c}"
+            for c in ALPHABET[1:] + ALPHABET[0]
+            for kc, kc_c in chars.items()
+            if kc_c == c and not kc.startswith("UM(")
+        ]
+
+        # Keys of the host layout first, then the unicode_map
+        keycodes = ["[AUTOCORRECT_BOUNDARY] = KC_SPC"]
+        for c in ALPHABET[1:]:
+            kcs = [kc for kc, kc_c in chars.items() if kc_c == c]
+            kcs.sort(key=lambda kc: not re.match(r"(KC|FR)_", kc))
+            kcs = [kc for kc in kcs if re.match(r"(KC|FR)_|UM\(", kc)]
+            if kcs:
+                keycodes.append(f"[{code(c)}] = {kcs[0]} /* {c} */")
+
+        # Every layer is listed, AUTOCORRECT_NO_TRIE is not 0
+        dictionaries = list(LAYER_DICTIONARIES)
+        layer_tries = [
+            f"[{km.layer_name(m)}] = "
+            + (
+                str(dictionaries.index(m.name))
+                if m.name in dictionaries
+                else "AUTOCORRECT_NO_TRIE"
             )
+            for km, m in self.layers
+        ]
+
+        self.autocorrect = tpl.format(
+            unicode=",\n".join(unicode),
+            keys="\n".join(keys),
+            keycodes=",\n".join(keycodes),
+            layer_tries=",\n".join(layer_tries),
+        )
 
-        for _, ckcs in self.custom_keys.items():
-            for name, (kc, skc) in ckcs.items():
-                self.custom_keycodes.append(name)
-                self.cases.append(
-                    custom_keycode_process_tpl.format(
-                        name=name, kc=kc, skc_name=self.unicode_to_idx[skc]
-                    )
-                )
-
-        self.custom_process = custom_process_tpl.format(cases="\n".join(self.cases))
-
-    def _gen_custom_autoshift(self):
-        autoshift_guard = """
-            if (IS_LAYER_ON({layer})) return false;
-        """
-        autoshift_press_user_tpl = """
-        static bool _autoshift_press_user(uint16_t keycode, bool shifted, keyrecord_t *record) {{
-            {guard}
-
-            bool tap_unicode = false;
-            uint16_t kc;
-            uint32_t skc_or_skc_idx;
-
-            {switch}
-
-            if (shifted && tap_unicode) {{
-                uint8_t temp_mod = get_mods();
-                clear_mods();
-                uint32_t skc = unicodemap_get_code_point(skc_or_skc_idx);
-                register_unicode(skc);
-                set_mods(temp_mod);
-                return false;
-            }}
-
-            register_code16(!shifted ? kc : skc_or_skc_idx);
-            return true;
-        }}
-        void autoshift_press_user(uint16_t keycode, bool shifted, keyrecord_t *record) {{
-            if (_autoshift_press_user(keycode, shifted, record)) return;
-            if (shifted) {{
-                add_weak_mods(MOD_BIT(KC_LSFT));
-            }}
-            // & 0xFF gets the Tap key for Tap Holds, required when using Retro Shift
-            register_code16((IS_RETRO(keycode)) ? keycode & 0xFF : keycode);
-        }}
-        """
-        autoshift_press_user_switch_tpl = """
-            if (IS_LAYER_ON({layer})) {{
-                switch(keycode) {{
-                    default:
-                        return false;
-                    {cases}
-                }}
-            }}
-        """
-        autoshift_user_case_tpl = """
-        case {kc}:
-            kc = {kc};
-            skc_or_skc_idx = {skc};
-            break;
-        """
-        autoshift_user_case_unicode_tpl = """
-        case {ckc}:
-            kc = {kc};
-            skc_or_skc_idx = {skc};
-            tap_unicode = true;
-            break;
-        """
+    def _gen_sequences(self):
+        """Trie of the dead key and compose sequences, see users/daedric/sequences.h."""
+        node_line = "{{{offset}, {count}}}"
+        entry_line = "{{{key}, {kc}, {skc}, {next}}}"
+        tpl = """
+const sequence_entry_t PROGMEM sequence_entries[] = {{
+    {entries}
+}};
+
+const sequence_node_t PROGMEM sequence_nodes[] = {{
+    {nodes},
+}};
+{autocorrect}
+"""
 
-        autoshift_release_user_tpl = """
-        static bool _autoshift_release_user(uint16_t keycode, bool shifted, keyrecord_t *record) {{
-            {guard}
+        class Node(dict):
+            output: tuple[str, str] | None = None
 
-            bool tap_unicode = false;
-            uint16_t kc;
-            uint32_t skc_or_skc_idx;
+        dead_key = Node()
+        for name, key in self.keys.items():
+            kc, skc = key.get_dead_key()
+            if name not in self.layer_keycodes[Mode.Base]:
+                continue
+            if is_transparent(kc) and is_transparent(skc):
+                continue
+            dead_key[self.layer_keycodes[Mode.Base][name]] = Node()
+            dead_key[self.layer_keycodes[Mode.Base][name]].output = (
+                self._sequence_output(kc, skc)
+            )
 
-            {switch}
+        for refs, cp in compose_sequences.items():
+            keys = [self._sequence_key(ref) for ref in refs]
+            # Keys not in this keymap
+            if None in keys:
+                continue
+            # Nothing typed before the dead key is replaced
+            if keys[0] != "CKC_DK":
+                raise Exception(f"compose sequences start with the dead key: {refs}")
+            node = dead_key
+            for k in keys[1:]:
+                if k not in node:
+                    node[k] = Node()
+                    # The key itself without the rest of the sequence
+                    node[k].output = self._sequence_typed(k)
+                node = node[k]
+            node.output = self._sequence_output(*compose_output(cp))
+
+        nodes = []
+        entries = []
+        pending = [dead_key]
+        while pending:
+            node = pending.pop(0)
+            nodes.append(node_line.format(offset=len(entries), count=len(node)))
+            for key, child in node.items():
+                next_node = "SEQUENCE_NONE"
+                if child:
+                    pending.append(child)
+                    next_node = len(nodes) + len(pending) - 1
+                kc, skc = child.output or ("KC_NO", "KC_NO")
+                entries.append(
+                    entry_line.format(key=key, kc=kc, skc=skc, next=next_node) + ","
+                )
+        if len(entries) > 0xFF or len(nodes) >= 0xFF:
+            raise Exception("too many sequence entries for the 8 bits indices")
+        self.sequences = tpl.format(
+            entries="\n".join(entries),
+            nodes=",\n".join(nodes),
+            autocorrect=self.autocorrect,
+        )
 
-            if (shifted && tap_unicode) {{
-                    return false;
-            }}
+    def _gen_custom_keys(self):
+        """Custom keycodes of the keymap, see users/daedric/custom_keys.h."""
+        tpl = """
+const custom_key_t PROGMEM custom_keys[CUSTOM_KEY_COUNT] = {{
+    {entries},
+}};
+"""
+        custom_key_entry_tpl = "[{name} - KEYMAP_SAFE_RANGE] = {{{kc}, {skc_name}}}"
+        custom_key_layer_move_tpl = "[{name} - KEYMAP_SAFE_RANGE] = {{TO({layer}), 0}}"
 
-            unregister_code16(!shifted ? kc : skc_or_skc_idx);
-            return true;
-        }}
-        void autoshift_release_user(uint16_t keycode, bool shifted, keyrecord_t *record) {{
-            if (_autoshift_release_user(keycode, shifted, record)) return;
-            unregister_code16((IS_RETRO(keycode)) ? keycode & 0xFF : keycode);
-        }}
-        """
+        # CKC_DK and CKC_HOST come from users/daedric
+        self.custom_keycodes = []
+        entries = []
 
-        cases_per_mode = defaultdict(list)
-        switches_press = []
-        switches_relea = []
-        for m, ovrs in self.override.items():
-            for _, ovr in ovrs.items():
-                cases_per_mode[m].append(
-                    autoshift_user_case_tpl.format(
-                        kc=ovr.kc,
-                        skc=ovr.skc,
-                    )
-                )
+        for km, m in self.layers:
+            ckc_name = f"CKC_LMOVE_{km.layer_name(m)}"
+            self.custom_keycodes.append(ckc_name)
+            entries.append(
+                custom_key_layer_move_tpl.format(name=ckc_name, layer=km.layer_name(m))
+            )
 
-        # Does not work, probably because those keys are handled by the
-        # process_record_user and we return false within it.
-        # It is likely that the fact that we do a register_unicode there
-        # make it impossible to have autoshift working.
-        # I wonder whether we could re-emit the custom keycode
-        # and handle it in the function
-        # Maybe autoshift + override could be replaced with: https://getreuer.info/posts/keyboards/custom-shift-keys/index.html
-        for m, ckcs in self.custom_keys.items():
+        for _, ckcs in self.custom_keys.items():
             for name, (kc, skc) in ckcs.items():
-                cases_per_mode[m].append(
-                    autoshift_user_case_unicode_tpl.format(
-                        ckc=name, kc=kc, skc=self.unicode_to_idx[skc]
+                self.custom_keycodes.append(name)
+                entries.append(
+                    custom_key_entry_tpl.format(
+                        name=name, kc=kc, skc_name=self.unicode_to_idx[skc]
                     )
                 )
 
-        mode_without_autoshift = [m for m in Mode if self.keymaps.has_keys(m)]
-        for m, cases in cases_per_mode.items():
-            mode_without_autoshift.remove(m)
-            switches_press.append(
-                autoshift_press_user_switch_tpl.format(
-                    layer=m.name, cases="\n".join(cases)
-                )
-            )
-            switches_relea.append(
-                autoshift_press_user_switch_tpl.format(
-                    layer=m.name, cases="\n".join(cases)
-                )
-            )
-
-        guard = "\n".join(
-            autoshift_guard.format(layer=l.name) for l in mode_without_autoshift
-        )
-        self.custom_autoshift = """
-        {press}
-        {relea}
-        """.format(
-            press=autoshift_press_user_tpl.format(
-                guard=guard, switch="\n".join(switches_press)
-            ),
-            relea=autoshift_release_user_tpl.format(
-                guard=guard, switch="\n".join(switches_relea)
-            ),
-        )
+        self.custom_keys_code = tpl.format(entries=",\n".join(entries))
 
     def _alias(self, name, value: KeyCode):
         if not isinstance(value, KeyCode):
@@ -848,11 +1326,11 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {{
         if v := self.aliases.get(name):
             if v != value:
                 raise Exception(f"conflict for {name}, we have {v} and {value}")
-            return name
+            return KeyCode(name)
         self.aliases[name] = value
         return KeyCode(name)
 
-    def _gen_kc(self, m: Mode, name, kc: KeyCode, skc: KeyCode):
+    def _gen_kc(self, m: Mode, layer: str, name, kc: KeyCode, skc: KeyCode):
         alias_name = f"{m.name}_{name}"
         match get_shift_mod(kc, skc):
             case ShiftMode.Default:
@@ -864,9 +1342,12 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {{
             case ShiftMode.CustomKey:
                 return self._create_custom_key(m, name, kc, skc)
             case ShiftMode.Override:
-                self._create_override(m, name, kc, skc)
+                self._create_override(m, layer, name, kc, skc)
                 return kc
             case ShiftMode.UnicodeMap:
+                for k in (kc, skc):
+                    if self.unicode_indices[self.unicode_to_idx[k]] > 0x7F:
+                        raise Exception(f"UP() only takes the first 128 entries: {k}")
                 a = self._alias(
                     alias_name,
                     KeyCode(
@@ -878,9 +1359,9 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {{
                 )
                 return a
 
-    def _gen(self, m: Mode):
-        l = self.keymaps.add_layer(m)
-        for n, coord in self.keymaps.base_keys():
+    def _gen(self, km: "Keymaps", m: Mode):
+        l = km.add_layer(m)
+        for n, coord in km.base_keys():
             key = self.keys.get(n.raw_keycode)
             if not key:
                 if m == Mode.Base:
@@ -895,39 +1376,200 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {{
             rkc, rskc = key.get_kc(m)
             kc.replace_keycode(rkc)
             skc = KeyCode(rskc)
-            final_kc = self._gen_kc(m, n.raw_keycode, kc, skc)
+            final_kc = self._gen_kc(m, km.layer_name(m), n.raw_keycode, kc, skc)
             l.set_key(coord, final_kc)
+            if isinstance(final_kc, KeyCode):
+                final_kc = final_kc.raw_keycode
+            self.layer_keycodes[m][n.raw_keycode] = final_kc
 
     def gen(self):
         extra_includes = []
+        if "fr" in self.hosts:
+            extra_includes.append("keymap_french.h")
         if self.host == "fr":
-            extra_includes = ["keymap_french.h", "sendstring_french.h"]
+            extra_includes.append("sendstring_french.h")
+
+        if len(self.hosts) == 1:
+            # Nothing to switch to
+            for km in self.variants.values():
+                for layer in km.final_layers.values():
+                    layer.replace("CKC_HOST", TRNS)
 
         self._gen_unicode_map()
-        for m in Mode:
-            self._gen(m)
+        self._gen_unicode_routes()
+        self._gen_hosts()
+        for km in self.variants.values():
+            for m in Mode:
+                self._gen(km, m)
+        # The base layers go first, the keymap in use is the default layer and
+        # eeconfig keeps it in 8 bits
+        self.layers = [
+            (km, m)
+            for base in (True, False)
+            for km in self.variants.values()
+            for m in Mode
+            if (m == Mode.Base) == base and km.has_keys(m)
+        ]
+        if len(self.variants) > 8:
+            raise Exception("too many keymaps for the 8 bits default layer")
+        # Where a base layer is transparent QMK falls back to layer 0, the
+        # base layer of another keymap
+        for km in list(self.variants.values())[1:]:
+            km.final_layers[Mode.Base].fill("KC_NO")
+        self._gen_keymap()
         self._gen_override()
+        self._gen_autocorrect()
+        self._gen_sequences()
         self._gen_custom_keys()
-        if self.autoshift:
-            self._gen_custom_autoshift()
+        if len(self.variants) > 1:
+            extra_includes.append("variants.h")
+            self._gen_variants()
 
         return self.file_tpl.format(
             extra_include="\n".join(map(lambda f: f'#include "{f}"', extra_includes)),
-            custom_keycodes=",\n".join(self.custom_keycodes),
-            layers=",\n".join(m.name for m in Mode if self.keymaps.has_keys(m)),
+            custom_keycodes=",\n".join(
+                [f"{self.custom_keycodes[0]} = KEYMAP_SAFE_RANGE"]
+                + self.custom_keycodes[1:]
+            ),
+            last_custom_keycode=self.custom_keycodes[-1],
+            layers=",\n".join(km.layer_name(m) for km, m in self.layers),
+            last_layer=self.layers[-1][0].layer_name(self.layers[-1][1]),
+            variants=len(self.variants) > 1 and self.variants_code or "",
             aliases="\n".join(
                 f"#define {name} {value}" for name, value in self.aliases.items()
             ),
             unicode_map=self.unicode_map,
+            unicode_routes=self.unicode_routes,
+            hosts=self.hosts_code,
             overrides=self.override_code,
+            keymap=self.keymap_code,
+            sequences=self.sequences,
+            custom_keys=self.custom_keys_code,
+        )
+
+    def _gen_keymap(self):
+        """Bitmaps of the keys which are not KC_TRNS and their packed keycodes,
+        see users/daedric/sparse_keymap.h."""
+        first = self.layers[0][0]
+        keys = self.keymap_keys = len(first.keys(Mode.Base))
+        layers = []
+        keycodes = []
+        offset = 0
+        for km, m in self.layers:
+            stored = []
+            bitmap = [0] * ((keys + 7) // 8)
+            for i, kc in enumerate(km.keys(m)):
+                if not is_transparent(kc):
+                    bitmap[i // 8] |= 1 << (i % 8)
+                    stored.append(kc)
+            rank = [0]
+            for b in bitmap[:-1]:
+                rank.append(rank[-1] + bin(b).count("1"))
+            layers.append(
+                f"[{km.layer_name(m)}] = {{"
+                f".bitmap = {{{', '.join(f'0x{b:02X}' for b in bitmap)}}}, "
+                f".rank = {{{', '.join(map(str, rank))}}}, "
+                f".offset = {offset}}}"
+            )
+            keycodes.append(f"// {km.layer_name(m)}\n" + ", ".join(stored) + ",")
+            offset += len(stored)
+
+        self.keymap_code = self.keymap_tpl.format(
             layouts=",\n".join(
-                f"[{m.name}] = LAYOUT({self.keymaps.format(m)})"
-                for m in Mode
-                if self.keymaps.has_keys(m)
+                f"[{km.layer_name(m)}] = LAYOUT({km.format(m, clang_format=False)})"
+                for km, m in self.layers
             ),
-            custom_process=self.custom_process,
-            custom_autoshift=self.autoshift and self.custom_autoshift or "",
+            positions=first.format_keys(list(range(1, keys + 1))),
+            layers=",\n".join(layers),
+            stored=offset,
+            total=keys * len(self.layers),
+            keycodes="\n".join(keycodes),
+        )
+
+    def _gen_variants(self):
+        """Switching between the keymaps of the firmware, see users/daedric/variants.h.
+
+        The combo is the right outer key of the top row and the inner left
+        thumb key, with their keycodes on layer 0: COMBO_ONLY_FROM_LAYER 0 in
+        config.h looks the keys up there whatever the keymap in use. QMK holds
+        back the keys of a combo until it can tell, so they must be rarely used
+        ones, not Esc.
+        """
+        tpl = """
+// Keymaps of the firmware, see users/daedric/variants.h
+#ifdef COMBO_ENABLE
+// Right outer key of the top row and inner left thumb key, switch to the next
+// keymap
+const uint16_t PROGMEM variant_combo[] = {{{combo}, COMBO_END}};
+combo_t key_combos[] = {{COMBO_ACTION(variant_combo)}};
+
+void process_combo_event(uint16_t combo_index, bool pressed) {{
+    // The only combo
+    (void)combo_index;
+    if (pressed) {{
+        variant_next();
+    }}
+}}
+#endif
+"""
+        base = self.layers[0][0].final_layers[Mode.Base]
+        combo = [str(base.rows[0][-1]), str(base.rows[-1][2])]
+        for kc in combo:
+            if is_transparent(kc) or base.keys().count(kc) > 1:
+                raise Exception(f"{kc} can't be a key of the variant combo")
+        self.variants_code = tpl.format(combo=", ".join(combo))
+
+    def gen_layers_header(self) -> str:
+        count = len(self.layers)
+        width = next(w for w in (8, 16, 32) if count <= w)
+        variant_layers = "\n".join(
+            f"#define VARIANT_LAYERS_{m.name} {{"
+            + ", ".join(
+                km.has_keys(m) and str(self.layers.index((km, m))) or "VARIANT_NO_LAYER"
+                for km in self.variants.values()
+            )
+            + "}"
+            for m in Mode
         )
+        # Layer of each keymap, base first, the indicators show it on 3 LEDs
+        layer_index = [
+            [l for l in self.layers if l[0] is km].index((km, m))
+            for km, m in self.layers
+        ]
+        if max(layer_index) > 7:
+            raise Exception(
+                "more than 8 layers in a keymap, the indicators can't show them"
+            )
+        astral = ""
+        if self.unicode_astral_first is not None:
+            astral = f"#define UNICODE_MAP_ASTRAL_FIRST {self.unicode_astral_first}\n"
+        return f"""// Generated by scripts/gen_keymap.py, included by config.h
+
+#pragma once
+
+// {", ".join(km.layer_name(m) for km, m in self.layers)}
+#define LAYER_COUNT {count}
+
+// The smallest layer_state_t for them
+// https://github.com/qmk/qmk_firmware/blob/a4da5f219fe0f202a07afa045fc0c08f6ce1f86b/docs/squeezing_avr.md#layers
+#define LAYER_STATE_{width}BIT
+#define RGBLIGHT_MAX_LAYERS {width}
+
+// Keymaps in the firmware, {", ".join(self.variants)}, and the layer of each
+// mode in them, see users/daedric/variants.h
+#define VARIANT_COUNT {len(self.variants)}
+#define VARIANT_NO_LAYER 0xFF
+{variant_layers}
+#define VARIANT_AUTOSHIFT {{{", ".join(str(int(name in self.autoshift_variants)) for name in self.variants)}}}
+#define VARIANT_LAYER_INDEX {{{", ".join(map(str, layer_index))}}}
+
+// Sizes of the tables of the keymap read by users/daedric
+#define KEYMAP_KEYS {self.keymap_keys}
+#define HOST_COUNT {len(self.hosts)}
+#define CUSTOM_KEY_COUNT {len(self.custom_keycodes)}
+#define UNICODE_MAP_COUNT {len(self.unicode_indices)}
+#define UNICODE_ROUTE_COUNT {self.unicode_route_count}
+{astral}"""
 
 
 fmt_layer = """
@@ -955,7 +1597,7 @@ keymaps = {
         _______, _______, _______, _______, _______, _______, _______,           _______, _______, _______, _______, _______, _______, _______,
         _______, _______, _______, _______, _______, _______, _______,           _______, _______, _______, _______, _______, _______, _______,
         _______, _______, _______, _______, _______, _______,                    _______, _______, _______, _______, _______, _______,
-        _______, _______, UC_PREV, UC_NEXT, QK_BOOT,         _______,     _______,       _______, _______, _______, _______, _______,
+        _______,CKC_HOST, UC_PREV, UC_NEXT, QK_BOOT,         _______,     _______,       _______, _______, _______, _______, _______,
                                            _______, _______, _______,     _______, _______, _______
         """,
     },
@@ -987,7 +1629,7 @@ keymaps = {
         Mode.Fn: """
         KC_F1 ,  KC_F2 ,  KC_F3 ,  KC_F4 ,  KC_F5 ,  KC_F6 ,  _______,           _______,  KC_F7 ,  KC_F8 ,  KC_F9 ,  KC_F10, KC_F11 , KC_F12 ,
         _______, _______, _______, _______, _______, _______, RGB_VAI,           _______, _______, _______, _______, _______, _______, _______,
-        _______, AC_TOGG, AS_TOGG, _______, _______, _______, RGB_VAD,           _______, _______, _______, _______, _______, _______, _______,
+        _______, AC_TOGG, AS_TOGG,CKC_HOST, _______, _______, RGB_VAD,           _______, _______, _______, _______, _______, _______, _______,
         _______, _______, _______, _______, _______, _______,                             _______, _______, _______, _______, _______, _______,
         _______, _______, _______, _______, _______,         _______,            _______,          _______, _______, _______, _______, _______,
                                            _______, _______, _______,            _______, _______, _______
@@ -1046,7 +1688,7 @@ keymaps = {
         """,
         Mode.Fn: """
         _______, _______, _______, _______, _______, _______, _______,            _______, _______, _______, _______, _______, _______, _______,
-        _______, AC_TOGG, _______, _______, _______, _______, _______,            _______, _______, _______, _______, _______, _______, _______,
+        _______, AC_TOGG,CKC_HOST, _______, _______, _______, _______,            _______, _______, _______, _______, _______, _______, _______,
         _______,  KC_F1 ,  KC_F2 ,  KC_F3 ,  KC_F4 ,  KC_F5 , _______,            _______,  KC_F6 ,  KC_F7 ,  KC_F8 ,  KC_F9 ,  KC_F10, _______,
         _______, _______, _______, _______, _______, _______,                               KC_F11,  KC_F12, _______, _______, _______, _______,
         _______, _______, _______, _______, _______,          _______,            _______,          _______, _______, _______, _______, _______,
@@ -1056,14 +1698,32 @@ keymaps = {
 }
 
 
-km = Keymaps(fmt_layer=fmt_layer, nb_keys=72)
-
-for mode, k in keymaps[args.keymap].items():
-    if mode == Mode.Base:
-        km.set_base(k)
-    else:
-        km.add_layer(mode, k)
-
-g = Gen(args.host, km, autoshift=args.autoshift)
-r = g.gen()
-print(r)
+def build(names: list[str], hosts: list[str], autoshift: list[str] | None) -> Gen:
+    """Generator of the firmware with the keymaps `names`, see the options."""
+    variants = {}
+    for name in names:
+        prefix = ""
+        if len(names) > 1:
+            prefix = "".join(part.capitalize() for part in name.split("_"))
+        km = Keymaps(fmt_layer=fmt_layer, nb_keys=72, prefix=prefix)
+        for mode, k in keymaps[name].items():
+            if mode == Mode.Base:
+                km.set_base(k)
+            else:
+                km.add_layer(mode, k)
+        variants[name] = km
+
+    # --autoshift alone is for all of them
+    if autoshift == []:
+        autoshift = names
+    return Gen(hosts, variants, autoshift=autoshift or [])
+
+
+if __name__ == "__main__":
+    args = parser.parse_args()
+    g = build(args.keymap, args.host, args.autoshift)
+    print(g.gen())
+
+    if args.layers_header:
+        with open(args.layers_header, "w") as f:
+            f.write(g.gen_layers_header())
@@ -0,0 +1,123 @@
+"""Generate the files of every build target of qmk.json in one run.
+
+Each target has its gen_keymap.py and moonlander_leds.py options in `targets`.
+The keymaps are all generated in this process, then clang-format runs on them
+in parallel. A file is only written when its content changed, so QMK does not
+rebuild the keymaps which are the same.
+
+    python scripts/gen_targets.py
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+from concurrent.futures import ThreadPoolExecutor
+from dataclasses import dataclass, field
+
+import gen_autocorrect
+import gen_keymap
+import moonlander_leds
+
+parser = argparse.ArgumentParser(description="Generate every build target.")
+parser.add_argument(
+    "--check",
+    action="store_true",
+    default=False,
+    help="Only report the files which are not up to date, and fail if any",
+)
+
+
+@dataclass
+class Target:
+    # --keymap, --host and --autoshift of gen_keymap.py
+    keymap: list[str] = field(default_factory=lambda: ["std"])
+    host: list[str] = field(default_factory=lambda: ["us"])
+    autoshift: list[str] | None = None
+    # --keymap of moonlander_leds.py, the target has no ledmap.h without it
+    leds: list[str] | None = None
+
+
+targets = {
+    "daedric": Target(keymap=["daedric"], autoshift=[], leds=["daedric"]),
+    "daedric_34": Target(keymap=["daedric_34"], leds=["daedric_34"]),
+    "ergol": Target(host=["us", "fr"]),
+    "ergolfr": Target(host=["fr"]),
+    "variants": Target(
+        keymap=["daedric", "daedric_34", "std"],
+        host=["us", "fr"],
+        autoshift=["daedric"],
+        leds=["daedric", "daedric_34", "std"],
+    ),
+}
+
+
+def clang_format(path: str, source: str) -> str:
+    return subprocess.run(
+        ["clang-format", f"--assume-filename={path}"],
+        input=source,
+        capture_output=True,
+        text=True,
+        check=True,
+    ).stdout
+
+
+def is_up_to_date(path: str, data: str) -> bool:
+    try:
+        with open(path, encoding="utf-8") as f:
+            return f.read() == data
+    except FileNotFoundError:
+        return False
+
+
+def gen_sources(root: str) -> tuple[dict[str, str], dict[str, str]]:
+    """Files of the targets by path, the ones for clang-format then the others."""
+    with open(os.path.join(root, "qmk.json")) as f:
+        build_targets = json.load(f)["build_targets"]
+
+    formatted, raw = {}, {}
+    for keyboard, keymap in build_targets:
+        if keymap not in targets:
+            sys.exit(f"{keyboard}:{keymap}: not in the targets of gen_targets.py")
+        target = targets[keymap]
+        path = os.path.join(root, "keyboards", keyboard, "keymaps", keymap)
+
+        g = gen_keymap.build(target.keymap, target.host, target.autoshift)
+        # Like the output of print() in gen_keymap.py
+        formatted[os.path.join(path, "keymap.c")] = g.gen() + "\n"
+        raw[os.path.join(path, "layers.h")] = g.gen_layers_header()
+        if target.leds:
+            formatted[os.path.join(path, "ledmap.h")] = (
+                moonlander_leds.gen(target.leds) + "\n"
+            )
+
+    defaults = gen_autocorrect.parser
+    raw.update(
+        gen_autocorrect.gen_headers(
+            root, defaults.get_default("dictionaries"), defaults.get_default("budget")
+        )
+    )
+    return formatted, raw
+
+
+if __name__ == "__main__":
+    args = parser.parse_args()
+    root = os.path.dirname(os.path.dirname(os.path.realpath(__file__)))
+
+    formatted, raw = gen_sources(root)
+    with ThreadPoolExecutor() as pool:
+        outputs = dict(
+            zip(formatted, pool.map(clang_format, formatted, formatted.values()))
+        )
+    outputs.update(raw)
+
+    stale = [path for path, data in outputs.items() if not is_up_to_date(path, data)]
+    for path in stale:
+        print(f"{os.path.relpath(path, root)}: {'stale' if args.check else 'written'}")
+        if not args.check:
+            with open(path, "w", encoding="utf-8") as f:
+                f.write(outputs[path])
+
+    if args.check and stale:
+        sys.exit(1)
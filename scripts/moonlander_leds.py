@@ -1,3 +1,28 @@
+"""Generate the per keymap LED map from a visual description of the layers.
+
+Colors are described in HSV like everywhere else in QMK, and converted to RGB
+here so the firmware does not have to do it.
+"""
+
+import argparse
+
+parser = argparse.ArgumentParser(description="Generate the LED map of a keymap.")
+parser.add_argument(
+    "--keymap",
+    choices=["daedric", "daedric_34", "std"],
+    nargs="+",
+    default=["daedric"],
+    help="Specify the keymap for which the LED map is generated. With several,"
+    " the layers are in the order of gen_keymap.py for them",
+)
+parser.add_argument(
+    "--report",
+    action="store_true",
+    default=False,
+    help="Compare the flash used by the LED map with a dense table, for every keymap",
+)
+
+
 layout = """
 0 5 10 15 20 25 29         65 61 56 51 46 41 36
 1 6 11 16 21 26 30         66 62 57 52 47 42 37
@@ -7,27 +32,282 @@ layout = """
              32 33 34   70 69 68
 """
 
+layout_indices = [int(col) for row in layout.split("\n") for col in row.split()]
+LED_COUNT = len(layout_indices)
+
+palette = {
+    "BLACK": (0x00, 0x00, 0x00),
+    "GREEN": (0x55, 0xFF, 0xFF),
+    "PURPL": (0xBF, 0xFF, 0xFF),
+    "RED": (0x00, 0xFF, 0xFF),
+    "GOLD": (0x24, 0xFF, 0xFF),
+    "WHITE": (0x00, 0x00, 0xFF),
+    "ORANG": (0x15, 0xFF, 0xFF),
+    "BLUE": (0xAC, 0xFF, 0xFF),
+}
+
+
+def hsv_to_rgb(h, s, v):
+    """Same integer conversion as QMK's `hsv_to_rgb` (quantum/color.c)."""
+    if s == 0:
+        return v, v, v
+
+    region = h * 6 // 255
+    remainder = ((h * 2 - region * 85) * 3) & 0xFF
+    p = (v * (255 - s)) >> 8
+    q = (v * (255 - ((s * remainder) >> 8))) >> 8
+    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8
+
+    match region:
+        case 0 | 6:
+            return v, t, p
+        case 1:
+            return q, v, p
+        case 2:
+            return p, v, t
+        case 3:
+            return p, q, v
+        case 4:
+            return t, p, v
+        case _:
+            return v, p, q
+
+
+# Layers are described as seen on the keyboard, in the order of `enum layers`.
+# Like `_______` in a keymap, `_____` lets the layers below show through, and
+# `None` is a fully transparent layer.
+TRNS = "_____"
+
+ledmaps = {
+    "daedric": {
+        "Base": """
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, GREEN,           GREEN, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,           BLACK, BLACK, BLACK, BLACK, GOLD , BLACK, BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,           BLACK, BLACK, BLACK, BLACK, BLACK, RED  , BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,                         BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK,         BLACK,     BLACK,             BLACK, BLACK, BLACK, BLACK, BLACK,
+                                    PURPL, BLACK, BLACK,      BLACK, BLACK, PURPL
+        """,
+        "Qwerty": """
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, GREEN,           GREEN, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,           BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,           BLACK, BLACK, BLACK, BLACK, BLACK, RED  , BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,                         BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK,         BLACK,     BLACK,             BLACK, BLACK, BLACK, BLACK, BLACK,
+                                    BLACK, BLACK, BLACK,      BLACK, BLACK, BLACK
+        """,
+        "Sym": None,
+        "Media": """
+        _____, _____, _____, _____, _____, _____, _____,           _____, _____, _____, _____, _____,  RED , ORANG,
+        _____, _____, _____, _____, _____, _____, _____,           _____, _____, _____, _____, _____, _____, _____,
+        _____, _____, _____, _____, _____, _____, _____,           _____, _____, _____, _____, _____, _____, _____,
+        _____, _____, _____, _____, _____, _____,                         _____, _____, _____, _____, _____, _____,
+        _____, _____, RED  , RED  , _____,         _____,     _____,             BLUE , BLUE , _____, _____, _____,
+                                    _____, _____, _____,      _____, _____, _____
+        """,
+        "Fn": """
+        _____, _____, _____, _____, _____, _____, _____,           _____, _____, _____, _____, _____, _____, _____,
+        _____, _____, _____, _____, _____, _____, WHITE,           _____, _____, _____, _____, _____, _____, _____,
+        _____, RED  , RED  , _____, _____, _____, WHITE,           _____, _____, _____, _____, _____, _____, _____,
+        _____, _____, _____, _____, _____, _____,                         _____, _____, _____, _____, _____, _____,
+        _____, _____, _____, _____, _____,         _____,     _____,             _____, _____, _____, _____, _____,
+                                    _____, _____, _____,      _____, _____, _____
+        """,
+    },
+    "daedric_34": {
+        "Base": """
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, GREEN,           GREEN, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,           BLACK, BLACK, BLACK, BLACK, GOLD , BLACK, BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,           BLACK, BLACK, BLACK, BLACK, BLACK, RED  , BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,                         BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK,         BLACK,     BLACK,             BLACK, BLACK, BLACK, BLACK, GREEN,
+                                    PURPL, BLACK, BLACK,      BLACK, BLACK, PURPL
+        """,
+        "Qwerty": """
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,           BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,           BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,           BLACK, BLACK, BLACK, BLACK, BLACK, RED  , BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,                         BLACK, BLACK, BLACK, BLACK, BLACK, BLACK,
+        BLACK, BLACK, BLACK, BLACK, BLACK,         BLACK,     BLACK,             BLACK, BLACK, BLACK, BLACK, PURPL,
+                                    BLACK, BLACK, BLACK,      BLACK, BLACK, BLACK
+        """,
+        "Sym": None,
+        "SymQwerty": None,
+        "Nav": """
+        _____, _____, _____, _____, _____, _____, _____,           _____, _____, _____, _____, _____, _____, _____,
+        _____, _____, _____, GREEN, _____, _____, _____,           _____, _____, ORANG, ORANG, ORANG, _____, _____,
+        _____, GOLD , GREEN, GREEN, GREEN, _____, _____,           _____, _____, ORANG, ORANG, ORANG, _____, _____,
+        _____, _____, _____, BLUE , _____, RED  ,                         WHITE, ORANG, ORANG, ORANG, _____, _____,
+        _____, _____, _____, _____, _____,         _____,     _____,             _____, _____, _____, _____, _____,
+                                    _____, _____, _____,      _____, _____, _____
+        """,
+        "Media": """
+        _____, _____, _____, _____, _____, _____, _____,           _____, _____, _____, _____, _____, _____, _____,
+        _____, _____, _____, _____, _____, _____, _____,           _____, _____, _____, _____, _____, RED  , ORANG,
+        _____, _____, _____, _____, _____, _____, _____,           _____, _____, _____, _____, _____, _____, _____,
+        _____, _____, RED  , RED  , _____, _____,                         _____, _____, _____, _____, _____, _____,
+        _____, _____, _____, _____, _____,         _____,     _____,             _____, _____, _____, _____, _____,
+                                    _____, _____, _____,      _____, _____, _____
+        """,
+        "Fn": """
+        _____, _____, _____, _____, _____, _____, _____,           _____, _____, _____, _____, _____, _____, _____,
+        _____, RED  , _____, _____, _____, _____, _____,           _____, _____, _____, _____, _____, _____, _____,
+        _____, GREEN, GREEN, GREEN, GREEN, GREEN, _____,           _____, GREEN, GREEN, GREEN, GREEN, GREEN, _____,
+        _____, _____, _____, _____, _____, _____,                         GREEN, GREEN, _____, _____, _____, _____,
+        _____, _____, _____, _____, _____,         _____,     _____,             _____, _____, _____, _____, _____,
+                                    _____, _____, _____,      _____, _____, _____
+        """,
+    },
+    "std": {
+        "Base": None,
+        "Sym": None,
+        "Fn": None,
+    },
+}
+
+
+def parse_layer(desc: str | None) -> list[str | None]:
+    """Color of each LED index, `None` when transparent."""
+    if desc is None:
+        return [None] * LED_COUNT
+
+    colors = [c.strip() for c in desc.replace("\n", ",").split(",") if c.strip()]
+    if len(colors) != LED_COUNT:
+        raise Exception(f"expected {LED_COUNT} colors, got {len(colors)}")
+    for c in colors:
+        if c != TRNS and c not in palette:
+            raise Exception(f"unknown color: {c}")
+
+    leds = [None] * LED_COUNT
+    for position, color in enumerate(colors):
+        leds[layout_indices[position]] = None if color == TRNS else color
+    return leds
 
-layout_indices = []
-for row in layout.split("\n"):
-    for col in row.split():
-        col = col.strip()
-        if not col:
-            continue
-        layout_indices.append(f"l{col}")
 
+def lit_leds(keymap: str) -> dict[str, list[tuple[int, str]]]:
+    """LEDs each layer has to set once the layers are composited.
 
-print(
+    A black LED is only kept when a layer below could light it, everything the
+    layers leave untouched ends up black anyway.
     """
-# define LED_LAYOUT({indices})\\
-    {indices_ordered}
+    lit = {}
+    below = set()
+    for name, desc in ledmaps[keymap].items():
+        leds = parse_layer(desc)
+        lit[name] = [
+            (led, c)
+            for led, c in enumerate(leds)
+            if c is not None and (c != "BLACK" or led in below)
+        ]
+        below.update(led for led, c in lit[name] if c != "BLACK")
+    return lit
 
-# define LED_LAYOUT_ALL(color) \\
-    LED_LAYOUT({each_color})
 
+def sizes(keymap: str) -> tuple[int, int]:
+    """Flash used by the dense table and by the sparse one, in bytes."""
+    nb_layers = len(ledmaps[keymap])
+    nb_entries = sum(len(entries) for entries in lit_leds(keymap).values())
+    dense = nb_layers * LED_COUNT * 3
+    # entries + per layer (offset, count) + palette
+    sparse = nb_entries * 2 + nb_layers * 2 + len(palette) * 3
+    return dense, sparse
+
+
+def variant_layers(keymaps: list[str]) -> list[tuple[str, str, str]]:
+    """Keymap, mode and name of the layers, like the `enum layers` of gen_keymap.py.
+
+    With several keymaps the base layers go first, and the names are prefixed
+    with the keymap.
+    """
+    prefix = {
+        km: "".join(part.capitalize() for part in km.split("_")) if len(keymaps) > 1 else ""
+        for km in keymaps
+    }
+    return [
+        (km, mode, prefix[km] + mode)
+        for base in (True, False)
+        for km in keymaps
+        for mode in ledmaps[km]
+        if (mode == "Base") == base
+    ]
+
+
+def gen(keymaps: list[str]) -> str:
+    colors = []
+    palette_lines = []
+    for name, hsv in palette.items():
+        r, g, b = hsv_to_rgb(*hsv)
+        colors.append(f"LED_COLOR_{name}")
+        palette_lines.append(f"[LED_COLOR_{name}] = {{{r:#04x}, {g:#04x}, {b:#04x}}}")
+
+    lit_layers = {km: lit_leds(km) for km in keymaps}
+    layers = []
+    entries = []
+    offset = 0
+    for km, mode, name in variant_layers(keymaps):
+        lit = lit_layers[km][mode]
+        layers.append(f"{{{offset}, {len(lit)}}}, // {name}")
+        if lit:
+            entries.append(f"// {name}")
+        entries.extend(f"{{{led}, LED_COLOR_{c}}}," for led, c in lit)
+        offset += len(lit)
+
+    if offset > 0xFF:
+        raise Exception("too many lit LEDs for the 8 bits offsets of ledmap")
+
+    dense = sum(sizes(km)[0] for km in keymaps)
+    sparse = 3 * len(palette) + 2 * (offset + len(layers))
+    return """// Generated by scripts/moonlander_leds.py --keymap {keymap}, do not edit.
+#pragma once
+
+// Flash used: {sparse} bytes, {dense} bytes as a dense RGB table.
+
+enum led_colors {{
+    {colors},
+}};
+
+// HSV palette converted to RGB at generation time
+const uint8_t PROGMEM led_palette[][3] = {{
+    {palette_lines},
+}};
+
+typedef struct {{
+    uint8_t led;
+    uint8_t color;
+}} led_entry_t;
+
+typedef struct {{
+    uint8_t offset;
+    uint8_t count;
+}} led_layer_t;
+
+// LEDs set by each layer, the others show the layers below or stay off
+const led_entry_t PROGMEM ledmap_entries[] = {{
+    {entries}
+}};
+
+// In the order of the layers of the keymap
+const led_layer_t PROGMEM ledmap[] = {{
+    {layers}
+}};
+
+_Static_assert(sizeof(ledmap) / sizeof(ledmap[0]) == LAYER_COUNT, "ledmap.h is not generated for this keymap");
 """.format(
-        indices=", ".join(layout_indices),
-        indices_ordered=", ".join(f"l{i}" for i in range(len(layout_indices))),
-        each_color=",".join(["(color)"] * len(layout_indices)),
+        keymap=" ".join(keymaps),
+        dense=dense,
+        sparse=sparse,
+        colors=",\n".join(colors),
+        palette_lines=",\n".join(palette_lines),
+        entries="\n".join(entries),
+        layers="\n".join(layers),
     )
-)
+
+
+if __name__ == "__main__":
+    args = parser.parse_args()
+    if args.report:
+        for km in ledmaps:
+            dense, sparse = sizes(km)
+            print(f"{km}: {sparse} bytes, {dense} bytes as a dense table")
+    else:
+        print(gen(args.keymap))
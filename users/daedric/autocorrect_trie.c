@@ -0,0 +1,100 @@
+#include "quantum.h"
+
+#include "autocorrect_trie.h"
+// The keymap's, QMK's autocorrect includes it too but does not use it, LTO
+// drops its copy
+#include "autocorrect_data.h"
+
+// Typed characters, the most recent last. It starts after a word boundary.
+static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {AUTOCORRECT_BOUNDARY};
+static uint8_t typo_buffer_size                    = 1;
+
+// The selected trie, in autocorrect_data
+static uint8_t        trie_index = AUTOCORRECT_NO_TRIE;
+static const uint8_t *trie       = autocorrect_data;
+static uint16_t       trie_size  = 0;
+
+bool process_autocorrect_user(uint16_t *keycode, keyrecord_t *record, uint8_t *buffer_size, uint8_t *mods) {
+    return false;
+}
+
+void autocorrect_select(uint8_t index) {
+    if (index == trie_index) {
+        return;
+    }
+    trie_index       = index;
+    typo_buffer_size = 0;
+    if (index == AUTOCORRECT_NO_TRIE) {
+        trie_size = 0;
+        return;
+    }
+    trie      = autocorrect_data + autocorrect_tries[index];
+    trie_size = autocorrect_tries[index + 1] - autocorrect_tries[index];
+}
+
+void autocorrect_backspace(void) {
+    if (typo_buffer_size > 0) {
+        typo_buffer_size--;
+    }
+}
+
+void autocorrect_reset(void) {
+    typo_buffer_size = 0;
+}
+
+// Same walk as QMK's process_autocorrect(), from the last typed character
+bool autocorrect_type(uint8_t code) {
+    if (code == AUTOCORRECT_NONE || trie_size == 0 || !autocorrect_is_enabled()) {
+        typo_buffer_size = 0;
+        return true;
+    }
+
+    if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
+        memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
+        typo_buffer_size = AUTOCORRECT_MAX_LENGTH - 1;
+    }
+    typo_buffer[typo_buffer_size++] = code;
+    if (typo_buffer_size < AUTOCORRECT_MIN_LENGTH) {
+        return true;
+    }
+
+    uint16_t state = 0;
+    uint8_t  node  = pgm_read_byte(trie);
+    for (int8_t i = typo_buffer_size - 1; i >= 0; i--) {
+        const uint8_t key = typo_buffer[i];
+        if (node & 64) {
+            // Branch, find the key and follow its link
+            node &= 63;
+            for (; node != key; node = pgm_read_byte(trie + (state += 3))) {
+                if (node == 0) {
+                    return true;
+                }
+            }
+            state = pgm_read_byte(trie + state + 1) | pgm_read_byte(trie + state + 2) << 8;
+        } else if (node != key) {
+            return true;
+        } else if ((node = pgm_read_byte(trie + (++state))) == 0) {
+            // End of a chain, its child follows
+            ++state;
+        }
+
+        // Only on corrupted data
+        if (state >= trie_size) {
+            return true;
+        }
+
+        node = pgm_read_byte(trie + state);
+        if (node & 128) {
+            autocorrect_apply_user(node & 63, trie + state + 1);
+            // The boundary is still typed, and starts the next word
+            if (code == AUTOCORRECT_BOUNDARY) {
+                typo_buffer[0]   = AUTOCORRECT_BOUNDARY;
+                typo_buffer_size = 1;
+                return true;
+            }
+            typo_buffer_size = 0;
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Autocorrect on characters instead of keycodes, so that custom keycodes and
+// unicode characters can be corrected. QMK's autocorrect only keeps the AC_*
+// keycodes and the EEPROM setting.
+//
+// Characters are the codes of ALPHABET in scripts/gen_autocorrect.py, the
+// keymap maps what it types to them.
+#define AUTOCORRECT_NONE 0
+#define AUTOCORRECT_BOUNDARY 1
+
+// autocorrect_data.h has one trie per layer, for none of them
+#define AUTOCORRECT_NO_TRIE 0xFF
+
+// Use another trie, the typed word is forgotten when it changes
+void autocorrect_select(uint8_t trie);
+
+// Feed a typed character, AUTOCORRECT_NONE for any key which is not part of a
+// word. Returns false when it completed a typo: autocorrect_apply_user() has
+// replaced it by its correction and the key must not be sent, unless it is a
+// word boundary.
+bool autocorrect_type(uint8_t code);
+void autocorrect_backspace(void);
+void autocorrect_reset(void);
+
+// Erase `backspaces` characters and type `correction`, codes in PROGMEM
+// ending with 0
+void autocorrect_apply_user(uint8_t backspaces, const uint8_t *correction);
@@ -0,0 +1,177 @@
+#include "quantum.h"
+
+#include "custom_keys.h"
+#include "hosts.h"
+#include "sequences.h"
+#include "unicode_queue.h"
+
+bool custom_key_get(uint16_t keycode, custom_key_t *ck) {
+    if (keycode < KEYMAP_SAFE_RANGE || keycode - KEYMAP_SAFE_RANGE >= CUSTOM_KEY_COUNT) {
+        return false;
+    }
+    ck->kc      = pgm_read_word(&custom_keys[keycode - KEYMAP_SAFE_RANGE].kc);
+    ck->skc_idx = pgm_read_byte(&custom_keys[keycode - KEYMAP_SAFE_RANGE].skc_idx);
+    return ck->kc != KC_NO;
+}
+
+// What a key sends unshifted and shifted, `skc` is an unicode_map index for
+// the custom keys.
+typedef struct {
+    uint16_t kc;
+    uint16_t skc;
+    bool     unicode;
+} shifted_key_t;
+
+// A basic key whose character is elsewhere on the host is sent by the engine,
+// shifted with the shifted character of the host
+static bool host_shifted_key_get(uint16_t keycode, shifted_key_t *sk) {
+#if HOST_COUNT > 1
+    uint16_t kc = host_keycode(keycode);
+    if (kc != keycode) {
+        *sk = (shifted_key_t){.kc = kc, .skc = host_keycode(S(keycode)), .unicode = false};
+        return true;
+    }
+#endif
+    return false;
+}
+
+static bool shifted_key_get(uint16_t keycode, keyrecord_t *record, shifted_key_t *sk) {
+    custom_key_t ck;
+    if (custom_key_get(keycode, &ck)) {
+        *sk = (shifted_key_t){.kc = host_keycode(ck.kc), .skc = ck.skc_idx, .unicode = true};
+        return !IS_QK_TO(ck.kc);
+    }
+
+    uint8_t layer  = layer_switch_get_layer(record->event.key);
+    uint8_t offset = pgm_read_byte(&shift_layers[layer].offset);
+    uint8_t count  = pgm_read_byte(&shift_layers[layer].count);
+    for (uint8_t i = offset; i < offset + count; i++) {
+        if (pgm_read_word(&shift_keys[i].kc) == keycode) {
+            *sk = (shifted_key_t){.kc = host_keycode(keycode), .skc = host_keycode(pgm_read_word(&shift_keys[i].skc)), .unicode = false};
+            return true;
+        }
+    }
+    return host_shifted_key_get(keycode, sk);
+}
+
+// Keycode held by the engine and the key holding it. Like with key overrides,
+// pressing another one of those keys releases it.
+static uint16_t shift_registered = KC_NO;
+static keypos_t shift_registered_key;
+
+static bool shift_release(keyrecord_t *record) {
+    if (shift_registered == KC_NO || (record && !KEYEQ(record->event.key, shift_registered_key))) {
+        return false;
+    }
+    unicode_queue_send(shift_registered, UNICODE_QUEUE_RELEASE);
+    shift_registered = KC_NO;
+    return true;
+}
+
+static void shift_press(const shifted_key_t *sk, keyrecord_t *record, bool shifted) {
+    shift_release(NULL);
+
+    if (shifted && sk->unicode) {
+        unicode_queue_push(sk->skc);
+        return;
+    }
+
+    shift_registered     = shifted ? sk->skc : sk->kc;
+    shift_registered_key = record->event.key;
+    unicode_queue_send(shift_registered, shifted ? UNICODE_QUEUE_PRESS_UNSHIFTED : UNICODE_QUEUE_PRESS);
+}
+
+// The sequences see the keys first, then the unicode_map keys, the layer moves
+// and the shift engine
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    if (!sequence_process(keycode, record)) {
+        return false;
+    }
+
+    if (IS_QK_UNICODEMAP(keycode) || IS_QK_UNICODEMAP_PAIR(keycode)) {
+        if (record->event.pressed) {
+            unicode_queue_push(unicode_map_index(keycode));
+        }
+        return false;
+    }
+
+#if HOST_COUNT > 1
+    if (keycode == CKC_HOST) {
+        if (record->event.pressed) {
+            host_next();
+        }
+        return false;
+    }
+
+    // The tap of a Tap Hold whose character is elsewhere on the host goes
+    // through the engine like a basic key, & 0xFF gets its Tap key
+    if ((IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) && record->tap.count != 0 && host_keycode(keycode & 0xFF) != (keycode & 0xFF)) {
+        keycode &= 0xFF;
+    }
+#endif
+
+    custom_key_t ck;
+    if (custom_key_get(keycode, &ck) && IS_QK_TO(ck.kc)) {
+        layer_move(QK_TO_GET_LAYER(ck.kc));
+        return false;
+    }
+
+    shifted_key_t sk;
+    bool engine = shifted_key_get(keycode, record, &sk);
+
+#ifdef AUTO_SHIFT_ENABLE
+    // Autoshift decides, and calls the engine from its hooks
+    if (get_autoshift_state() && get_auto_shifted_key(keycode, record)) {
+        return true;
+    }
+#endif
+
+    if (!engine) {
+        // Anything typed after the queued characters is sent after them
+        return unicode_queue_record(keycode, record);
+    }
+
+    if (!record->event.pressed) {
+        // A basic key not pressed through the engine is released by QMK
+        return !shift_release(record) && !sk.unicode && unicode_queue_record(keycode, record);
+    }
+
+    if ((get_mods() & MOD_MASK_SHIFT) != 0) {
+        shift_press(&sk, record, true);
+        return false;
+    }
+
+    if (!sk.unicode && sk.kc == keycode) {
+        return unicode_queue_record(keycode, record);
+    }
+    shift_press(&sk, record, false);
+    return false;
+}
+
+#ifdef AUTO_SHIFT_ENABLE
+bool get_custom_auto_shifted_key(uint16_t keycode, keyrecord_t *record) {
+    // Unicode keys can be autoshifted too, they are sent by the engine
+    custom_key_t ck;
+    return custom_key_get(keycode, &ck) && !IS_QK_TO(ck.kc);
+}
+
+void autoshift_press_user(uint16_t keycode, bool shifted, keyrecord_t *record) {
+    shifted_key_t sk;
+    if (shifted_key_get(keycode, record, &sk)) {
+        // Held shift goes through autoshift too
+        shift_press(&sk, record, shifted || (get_mods() & MOD_MASK_SHIFT) != 0);
+        return;
+    }
+    // & 0xFF gets the Tap key for Tap Holds, required when using Retro Shift
+    unicode_queue_send((IS_RETRO(keycode)) ? keycode & 0xFF : keycode, shifted ? UNICODE_QUEUE_PRESS_SHIFTED : UNICODE_QUEUE_PRESS);
+}
+
+void autoshift_release_user(uint16_t keycode, bool shifted, keyrecord_t *record) {
+    shifted_key_t sk;
+    if (shifted_key_get(keycode, record, &sk)) {
+        shift_release(record);
+        return;
+    }
+    unicode_queue_send((IS_RETRO(keycode)) ? keycode & 0xFF : keycode, UNICODE_QUEUE_RELEASE);
+}
+#endif
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+
+// Keycodes of users/daedric, the custom keycodes of the generated keymap
+// follow from KEYMAP_SAFE_RANGE
+enum daedric_keycodes {
+    // Dead key of the sequences, see sequences.h
+    CKC_DK = SAFE_RANGE,
+    // Next host, see hosts.h
+    CKC_HOST,
+    KEYMAP_SAFE_RANGE,
+};
+
+typedef struct {
+    uint16_t kc;
+    uint8_t  skc_idx;
+} custom_key_t;
+
+typedef struct {
+    uint16_t kc;
+    uint16_t skc;
+} shift_key_t;
+
+typedef struct {
+    uint8_t offset;
+    uint8_t count;
+} shift_layer_t;
+
+// Generated with the keymap, CUSTOM_KEY_COUNT comes from layers.h. Indexed by
+// keycode - KEYMAP_SAFE_RANGE, a custom key sends `kc`, or the unicode_map
+// entry `skc_idx` when shifted. The layer moves are stored as TO(layer).
+extern const custom_key_t PROGMEM custom_keys[CUSTOM_KEY_COUNT];
+
+// Keycode sent instead of a key when it is shifted, shift itself is not sent.
+// Only the entries of the layer the key comes from are looked at.
+extern const shift_key_t PROGMEM   shift_keys[];
+extern const shift_layer_t PROGMEM shift_layers[LAYER_COUNT];
+
+// False when `keycode` is not one of the custom_keys
+bool custom_key_get(uint16_t keycode, custom_key_t *ck);
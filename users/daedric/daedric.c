@@ -0,0 +1,308 @@
+#include <string.h>
+
+#include "color.h"
+#include "quantum.h"
+#include QMK_KEYBOARD_H
+
+#include "version.h"
+#include "config.h"
+#include "indicators.h"
+#include "transport.h"
+#include "variants.h"
+
+static void init_led_for_input_mode(void);
+static void variant_apply(uint8_t variant);
+
+void keyboard_post_init_user(void) {
+    /* debug_enable = true; */
+    /* debug_matrix   = true; */
+    /* debug_keyboard = true; */
+    // debug_mouse=true;
+
+    variant_init();
+    variant_apply(variant_current());
+    init_led_for_input_mode();
+}
+
+static void init_led_for_input_mode(void) {
+    uint8_t mode;
+    switch (detected_host_os()) {
+        case OS_UNSURE:
+        case OS_LINUX:
+            mode = UNICODE_MODE_LINUX;
+            break;
+        case OS_WINDOWS:
+            mode = UNICODE_MODE_WINCOMPOSE;
+            break;
+        case OS_MACOS:
+        case OS_IOS:
+            mode = UNICODE_MODE_MACOS;
+            break;
+    }
+
+    set_unicode_input_mode(mode);
+    indicators_set_input_mode(mode);
+}
+
+#include "ledmap.h"
+
+// LEDs under the autocorrect and autoshift toggles of the Fn layer, they show
+// whether it is on. NO_LED when the variant doesn't have the key.
+static uint8_t fn_led_autocorrect = NO_LED;
+static uint8_t fn_led_autoshift   = NO_LED;
+
+static uint8_t fn_led(uint8_t variant, uint16_t keycode) {
+    uint8_t fn = VARIANT_OF(VARIANT_LAYERS_Fn, variant);
+    if (fn == VARIANT_NO_LAYER) {
+        return NO_LED;
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (keymap_key_to_keycode(fn, (keypos_t){.row = row, .col = col}) == keycode) {
+                return g_led_config.matrix_co[row][col];
+            }
+        }
+    }
+    return NO_LED;
+}
+
+static void variant_apply(uint8_t variant) {
+#ifdef AUTO_SHIFT_ENABLE
+    if (VARIANT_OF(VARIANT_AUTOSHIFT, variant)) {
+        autoshift_enable();
+    } else {
+        autoshift_disable();
+    }
+#endif
+    fn_led_autocorrect = fn_led(variant, AC_TOGG);
+    fn_led_autoshift   = fn_led(variant, AS_TOGG);
+}
+
+layer_state_t default_layer_state_set_user(layer_state_t state) {
+    variant_apply(variant_get(state));
+    return state;
+}
+
+// Fn from SymQwerty and Nav on Qwerty, in the variants which have them
+layer_state_t layer_state_set_user(layer_state_t state) {
+    uint8_t base       = VARIANT_LAYER(Base);
+    uint8_t qwerty     = VARIANT_LAYER(Qwerty);
+    uint8_t sym_qwerty = VARIANT_LAYER(SymQwerty);
+    uint8_t nav        = VARIANT_LAYER(Nav);
+    uint8_t fn         = VARIANT_LAYER(Fn);
+    if (qwerty == VARIANT_NO_LAYER || sym_qwerty == VARIANT_NO_LAYER || nav == VARIANT_NO_LAYER || fn == VARIANT_NO_LAYER) {
+        return state;
+    }
+
+    if (IS_LAYER_ON_STATE(state, base)) {
+        // XXX: todo
+    } else if (IS_LAYER_ON_STATE(state, qwerty)) {
+        state = update_tri_layer_state(state, sym_qwerty, nav, fn);
+    }
+
+    return state;
+}
+
+// Inputs the LED frame depends on, the frame is only rendered again when one
+// of them changes.
+typedef struct {
+    layer_state_t layer_state;
+    uint8_t       val;
+    bool          autocorrect;
+    bool          autoshift;
+} led_frame_key_t;
+
+static RGB             led_frame[RGB_MATRIX_LED_COUNT];
+static led_frame_key_t led_frame_key;
+static bool            led_frame_valid = false;
+
+// How many frames were rendered vs. reused from the cache, to measure what the
+// cache saves in the main loop (visible with `debug_enable`).
+static uint32_t led_frame_redraws = 0;
+static uint32_t led_frame_skipped = 0;
+
+// Channel value scaled by the matrix brightness, rebuilt when it changes so
+// rendering a frame is only table lookups.
+static uint8_t led_scale[256];
+
+static void led_scale_update(uint8_t val) {
+    for (uint16_t c = 0; c < 256; c++) {
+        led_scale[c] = c * val / UINT8_MAX;
+    }
+}
+
+static RGB led_color(const uint8_t color[3]) {
+    return (RGB){
+        .r = led_scale[pgm_read_byte(&color[0])],
+        .g = led_scale[pgm_read_byte(&color[1])],
+        .b = led_scale[pgm_read_byte(&color[2])],
+    };
+}
+
+static uint8_t status_color(bool enabled) {
+    return enabled ? LED_COLOR_GREEN : LED_COLOR_RED;
+}
+
+#ifndef LED_COMPOSITE_CACHE_SIZE
+#    define LED_COMPOSITE_CACHE_SIZE 4
+#endif
+
+// Palette colors of the composited layers for the last layer states seen,
+// switching back and forth between a few layers doesn't walk the map again.
+typedef struct {
+    layer_state_t state;
+    uint8_t       colors[RGB_MATRIX_LED_COUNT];
+} led_composite_t;
+
+static led_composite_t led_composites[LED_COMPOSITE_CACHE_SIZE];
+static uint8_t         led_composites_used = 0;
+static uint8_t         led_composites_next = 0;
+
+static void led_composite(layer_state_t state, uint8_t colors[RGB_MATRIX_LED_COUNT]) {
+    uint8_t set[(RGB_MATRIX_LED_COUNT + 7) / 8] = {0};
+
+    // LEDs no layer sets stay off
+    memset(colors, LED_COLOR_BLACK, RGB_MATRIX_LED_COUNT);
+
+    // Top-down, the highest active layer setting a LED wins
+    for (int8_t layer = ARRAY_SIZE(ledmap) - 1; layer >= 0; layer--) {
+        if (!(state & ((layer_state_t)1 << layer))) {
+            continue;
+        }
+
+        uint8_t offset = pgm_read_byte(&ledmap[layer].offset);
+        uint8_t count  = pgm_read_byte(&ledmap[layer].count);
+        for (uint8_t i = offset; i < offset + count; i++) {
+            uint8_t led = pgm_read_byte(&ledmap_entries[i].led);
+            if (!(set[led / 8] & (1 << (led % 8)))) {
+                colors[led] = pgm_read_byte(&ledmap_entries[i].color);
+                set[led / 8] |= 1 << (led % 8);
+            }
+        }
+    }
+}
+
+static const uint8_t *led_composite_get(layer_state_t state) {
+    for (uint8_t i = 0; i < led_composites_used; i++) {
+        if (led_composites[i].state == state) {
+            return led_composites[i].colors;
+        }
+    }
+
+    // Miss, replace the oldest entry
+    led_composite_t *slot = &led_composites[led_composites_next];
+    led_composites_next   = (led_composites_next + 1) % LED_COMPOSITE_CACHE_SIZE;
+    if (led_composites_used < LED_COMPOSITE_CACHE_SIZE) {
+        led_composites_used++;
+    }
+
+    slot->state = state;
+    led_composite(state, slot->colors);
+    return slot->colors;
+}
+
+void set_layer_color(layer_state_t state) {
+    const uint8_t *colors = led_composite_get(state);
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        led_frame[i] = led_color(led_palette[colors[i]]);
+    }
+
+    // Toggle reg/green depending on whether the autocorrect/autoshift is on or off
+    uint8_t fn = VARIANT_LAYER(Fn);
+    if (fn != VARIANT_NO_LAYER && IS_LAYER_ON_STATE(state, fn)) {
+        if (fn_led_autocorrect != NO_LED) {
+            led_frame[fn_led_autocorrect] = led_color(led_palette[status_color(autocorrect_is_enabled())]);
+        }
+#ifdef AUTO_SHIFT_ENABLE
+        if (fn_led_autoshift != NO_LED) {
+            led_frame[fn_led_autoshift] = led_color(led_palette[status_color(get_autoshift_state())]);
+        }
+#endif
+    }
+}
+
+static led_frame_key_t led_frame_current_key(void) {
+    return (led_frame_key_t){
+        .layer_state = layer_state | default_layer_state,
+        .val         = rgb_matrix_config.hsv.v,
+        .autocorrect = autocorrect_is_enabled(),
+#ifdef AUTO_SHIFT_ENABLE
+        .autoshift = get_autoshift_state(),
+#endif
+    };
+}
+
+static bool led_frame_key_equal(const led_frame_key_t *a, const led_frame_key_t *b) {
+    return a->layer_state == b->layer_state && a->val == b->val && a->autocorrect == b->autocorrect && a->autoshift == b->autoshift;
+}
+
+bool rgb_matrix_indicators_user(void) {
+    if (keyboard_config.disable_layer_led) {
+        return false;
+    }
+
+    led_frame_key_t key = led_frame_current_key();
+    if (led_frame_valid && led_frame_key_equal(&key, &led_frame_key)) {
+        led_frame_skipped++;
+    } else {
+        if (!led_frame_valid || key.val != led_frame_key.val) {
+            led_scale_update(key.val);
+        }
+        set_layer_color(key.layer_state);
+        led_frame_key   = key;
+        led_frame_valid = true;
+        led_frame_redraws++;
+        dprintf("leds: redraw %lu, %lu skipped\n", led_frame_redraws, led_frame_skipped);
+    }
+
+    // The active effect repaints the whole matrix before the indicators run,
+    // so the cached frame still has to be written on every frame.
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_matrix_set_color(i, led_frame[i].r, led_frame[i].g, led_frame[i].b);
+    }
+
+    // The layers of the variant in use, there can be more than 8 in all
+    indicators_set_layer(variant_layer_index(biton32(layer_state)));
+
+    return true;
+}
+
+void unicode_input_mode_set_user(uint8_t input_mode) {
+    indicators_set_input_mode(input_mode);
+}
+
+// Layer to go back to once the right half is connected again
+static uint8_t transport_previous_layer = 0;
+
+void transport_disconnected_user(void) {
+    uint8_t qwerty = VARIANT_LAYER(Qwerty);
+    if (qwerty == VARIANT_NO_LAYER) {
+        return;
+    }
+    // Only the left half is left, fall back to the plain layout
+    transport_previous_layer = get_highest_layer(layer_state | default_layer_state);
+    layer_move(qwerty);
+}
+
+void transport_connected_user(void) {
+    uint8_t qwerty = VARIANT_LAYER(Qwerty);
+    if (qwerty != VARIANT_NO_LAYER && biton32(layer_state) == qwerty && transport_previous_layer != qwerty) {
+        layer_move(transport_previous_layer);
+    }
+}
+
+void housekeeping_task_user(void) {
+    indicators_task();
+    transport_watchdog_task();
+}
+
+void suspend_power_down_user(void) {
+    indicators_suspend();
+}
+
+void suspend_wakeup_init_user(void) {
+    init_led_for_input_mode();
+    // The matrix shows the cached frame again on its own, the indicators come
+    // back from housekeeping
+    indicators_wakeup();
+}
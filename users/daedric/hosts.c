@@ -0,0 +1,47 @@
+#include "quantum.h"
+
+#include "hosts.h"
+
+#if HOST_COUNT > 1
+#    define HOST_UNKNOWN 0xFF
+
+static uint8_t host = HOST_UNKNOWN;
+
+static uint8_t host_get(void) {
+    if (host == HOST_UNKNOWN) {
+        // Anything else in eeconfig, like after a reset, is the first host
+        uint32_t stored = eeconfig_read_user();
+        host            = stored < HOST_COUNT ? stored : 0;
+    }
+    return host;
+}
+
+void host_next(void) {
+    host = (host_get() + 1) % HOST_COUNT;
+    eeconfig_update_user(host);
+    dprintf("host: %u\n", host);
+}
+
+uint16_t host_keycode(uint16_t kc) {
+    uint8_t basic = QK_MODS_GET_BASIC_KEYCODE(kc);
+    if (host_get() == 0 || kc > QK_MODS_MAX || basic < HOST_KEY_FIRST || basic > HOST_KEY_LAST) {
+        return kc;
+    }
+
+    uint8_t  mods       = QK_MODS_GET_MODS(kc);
+    uint16_t translated = pgm_read_word(&host_keys[host - 1][basic - HOST_KEY_FIRST][(mods & MOD_LSFT) != 0]);
+    uint8_t  host_mods  = QK_MODS_GET_MODS(translated);
+    mods &= ~MOD_LSFT;
+    if (translated == KC_NO) {
+        return kc;
+    }
+    if ((mods & 0xF) == 0) {
+        return translated;
+    }
+    // Left and right modifiers don't mix in a keycode
+    if (host_mods != 0 && ((mods ^ host_mods) & 0x10) != 0) {
+        return kc;
+    }
+    return translated | (uint16_t)mods << 8;
+}
+#endif
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "quantum.h"
+
+// Hosts the keymap is typed on, HOST_COUNT of layers.h. It is written for the
+// first one, the characters of its basic keys are sent with the keys of the
+// others. CKC_HOST switches to the next one, kept in the user word of eeconfig.
+#if HOST_COUNT > 1
+#    define HOST_KEY_FIRST KC_A
+#    define HOST_KEY_LAST KC_SLASH
+
+// Generated with the keymap. Keys typing the character of a basic key on the
+// other hosts, unshifted then shifted, KC_NO for the keys which are not
+// characters.
+extern const uint16_t PROGMEM host_keys[HOST_COUNT - 1][HOST_KEY_LAST - HOST_KEY_FIRST + 1][2];
+
+// Keycode typing on the host what `kc` types on the first one. The other
+// modifiers of a shortcut are kept when they can go with the ones of the
+// character.
+uint16_t host_keycode(uint16_t kc);
+
+void host_next(void);
+#else
+// The keymap is written for the host, see --host of gen_keymap.py
+static inline uint16_t host_keycode(uint16_t kc) {
+    return kc;
+}
+#endif
@@ -0,0 +1,115 @@
+#include "quantum.h"
+#include QMK_KEYBOARD_H
+
+#include "indicators.h"
+
+#ifndef INDICATORS_WAKEUP_DELAY
+// Give the right half's I/O expander time to come back before writing to it
+#    define INDICATORS_WAKEUP_DELAY 50
+#endif
+
+typedef enum {
+    INDICATORS_ACTIVE,
+    INDICATORS_SUSPENDED,
+    INDICATORS_WAKING,
+} indicators_state_t;
+
+// What the LEDs should show, and what they actually show. They only differ
+// while suspended, all of them are off at boot.
+static uint8_t            indicators       = 0;
+static uint8_t            indicators_shown = 0;
+static indicators_state_t indicators_state = INDICATORS_ACTIVE;
+static uint16_t           indicators_timer = 0;
+
+static void indicator_write(uint8_t led, bool on) {
+    switch (led) {
+        case 0:
+            ML_LED_1(on);
+            break;
+        case 1:
+            ML_LED_2(on);
+            break;
+        case 2:
+            ML_LED_3(on);
+            break;
+        case 3:
+            ML_LED_4(on);
+            break;
+        case 4:
+            ML_LED_5(on);
+            break;
+        case 5:
+            ML_LED_6(on);
+            break;
+    }
+}
+
+static void indicators_show(uint8_t next) {
+    uint8_t changed = indicators_shown ^ next;
+    if (!changed) {
+        return;
+    }
+
+    for (uint8_t led = 0; led < INDICATOR_COUNT; led++) {
+        if (changed & (1 << led)) {
+            indicator_write(led, next & (1 << led));
+        }
+    }
+    indicators_shown = next;
+}
+
+void indicators_update(uint8_t mask, uint8_t bits) {
+    indicators = (indicators & ~mask) | (bits & mask);
+    if (indicators_state == INDICATORS_ACTIVE) {
+        indicators_show(indicators);
+    }
+}
+
+uint8_t indicators_get(void) {
+    return indicators;
+}
+
+void indicators_set_layer(uint8_t layer) {
+    // Layer of the variant in use, a keymap has 8 at most and Base is all off
+    indicators_update(INDICATOR_LAYER_MASK, layer << INDICATOR_LAYER_SHIFT);
+}
+
+void indicators_set_input_mode(uint8_t input_mode) {
+    uint8_t bits;
+    switch (input_mode) {
+        case UNICODE_MODE_LINUX:
+            bits = 0x1;
+            break;
+        case UNICODE_MODE_WINCOMPOSE:
+        case UNICODE_MODE_WINDOWS:
+            bits = 0x2;
+            break;
+        case UNICODE_MODE_MACOS:
+            bits = 0x4;
+            break;
+        default:
+            bits = 0x7;
+            break;
+    }
+    indicators_update(INDICATOR_INPUT_MODE_MASK, bits << INDICATOR_INPUT_MODE_SHIFT);
+}
+
+// ChibiOS calls suspend_power_down_user() in a loop while suspended and
+// housekeeping doesn't run, so the LEDs are turned off right away. Calling it
+// again costs nothing as nothing changes.
+void indicators_suspend(void) {
+    indicators_state = INDICATORS_SUSPENDED;
+    indicators_show(0);
+}
+
+void indicators_wakeup(void) {
+    indicators_state = INDICATORS_WAKING;
+    indicators_timer = timer_read();
+}
+
+void indicators_task(void) {
+    if (indicators_state == INDICATORS_WAKING && timer_elapsed(indicators_timer) >= INDICATORS_WAKEUP_DELAY) {
+        indicators_state = INDICATORS_ACTIVE;
+        indicators_show(indicators);
+    }
+}
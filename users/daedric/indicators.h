@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The six Moonlander indicator LEDs as a mask, bit 0 is ML_LED_1.
+//
+// ML_LED_1..3 (left half) show the highest active layer in binary, counted
+// from the base layer of the variant in use (see variants.h), ML_LED_4..6
+// (right half) show the unicode input mode.
+#define INDICATOR_COUNT 6
+
+#define INDICATOR_LAYER_SHIFT 0
+#define INDICATOR_LAYER_MASK (0x7 << INDICATOR_LAYER_SHIFT)
+#define INDICATOR_INPUT_MODE_SHIFT 3
+#define INDICATOR_INPUT_MODE_MASK (0x7 << INDICATOR_INPUT_MODE_SHIFT)
+#define INDICATOR_ALL_MASK (INDICATOR_LAYER_MASK | INDICATOR_INPUT_MODE_MASK)
+
+// Replace the bits of `mask` by `bits`, only the LEDs that change are written.
+void    indicators_update(uint8_t mask, uint8_t bits);
+uint8_t indicators_get(void);
+
+void indicators_set_layer(uint8_t layer);
+void indicators_set_input_mode(uint8_t input_mode);
+
+// Turn the LEDs off while suspended and show them again on wakeup, without
+// blocking. indicators_task() must be called from housekeeping.
+void indicators_suspend(void);
+void indicators_wakeup(void);
+void indicators_task(void);
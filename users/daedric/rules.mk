@@ -0,0 +1,23 @@
+# The runtime of the keymaps generated by scripts/gen_keymap.py, which only
+# have its tables
+SRC += sparse_keymap.c
+SRC += unicode_queue.c
+SRC += hosts.c
+SRC += sequences.c
+SRC += custom_keys.c
+
+# The keymaps of the firmware and what they share, see variants.h
+SRC += variants.c
+
+# The LEDs and the USB watchdog of the daedric keymaps, the ergol ones only
+# take the runtime
+ifneq ($(strip $(DAEDRIC_RUNTIME_ONLY)), yes)
+    SRC += daedric.c
+    SRC += indicators.c
+    SRC += transport.c
+endif
+
+# The keymap feeds the characters it types, see autocorrect_trie.h
+ifeq ($(strip $(AUTOCORRECT_ENABLE)), yes)
+    SRC += autocorrect_trie.c
+endif
@@ -0,0 +1,190 @@
+#include "quantum.h"
+
+#include "custom_keys.h"
+#include "hosts.h"
+#include "sequences.h"
+#include "unicode_queue.h"
+#include "variants.h"
+
+static uint8_t sequence_find(uint8_t node, uint16_t key) {
+    uint8_t offset = pgm_read_byte(&sequence_nodes[node].offset);
+    uint8_t count  = pgm_read_byte(&sequence_nodes[node].count);
+    for (uint8_t i = offset; i < offset + count; i++) {
+        if (pgm_read_word(&sequence_entries[i].key) == key) {
+            return i;
+        }
+    }
+    return SEQUENCE_NONE;
+}
+
+static uint16_t sequence_output(uint8_t entry, bool shifted) {
+    return pgm_read_word(shifted ? &sequence_entries[entry].skc : &sequence_entries[entry].kc);
+}
+
+static void sequence_send(uint16_t kc) {
+    if (IS_QK_UNICODEMAP(kc)) {
+        unicode_queue_push(QK_UNICODEMAP_GET_INDEX(kc));
+        return;
+    }
+
+    unicode_queue_tap(host_keycode(kc), UNICODE_QUEUE_PRESS_UNSHIFTED);
+}
+
+#ifdef AUTOCORRECT_ENABLE
+#    include "autocorrect_trie.h"
+
+static uint8_t autocorrect_code(uint16_t keycode) {
+    if (IS_QK_UNICODEMAP(keycode) || IS_QK_UNICODEMAP_PAIR(keycode)) {
+        return pgm_read_byte(&autocorrect_unicode[unicode_map_index(keycode)]);
+    }
+    custom_key_t ck;
+    if (custom_key_get(keycode, &ck)) {
+        if (IS_QK_TO(ck.kc)) {
+            return AUTOCORRECT_NONE;
+        }
+        keycode = ck.kc;
+    }
+    // The letters go first
+    for (const autocorrect_key_t *key = autocorrect_keys;; key++) {
+        uint16_t kc = pgm_read_word(&key->keycode);
+        if (kc == keycode) {
+            return pgm_read_byte(&key->code);
+        }
+        if (kc == KC_NO) {
+            return AUTOCORRECT_NONE;
+        }
+    }
+}
+
+void autocorrect_apply_user(uint8_t backspaces, const uint8_t *correction) {
+    for (uint8_t i = 0; i < backspaces; i++) {
+        unicode_queue_tap(KC_BSPC, UNICODE_QUEUE_PRESS);
+    }
+    for (uint8_t code; (code = pgm_read_byte(correction)) != 0; correction++) {
+        sequence_send(pgm_read_word(&autocorrect_keycodes[code]));
+    }
+}
+
+// Trie of the lowest active layer, the one moved to
+static uint8_t autocorrect_layer_trie(void) {
+    layer_state_t state = layer_state ? layer_state : default_layer_state;
+    return pgm_read_byte(&autocorrect_layer_tries[get_highest_layer(state & -state)]);
+}
+
+// Returns false when the key completed a typo and was replaced
+static bool autocorrect_process(uint16_t keycode) {
+    autocorrect_select(autocorrect_layer_trie());
+    if ((get_mods() & ~MOD_MASK_SHIFT) != 0) {
+        autocorrect_reset();
+        return true;
+    }
+    if (keycode == KC_BSPC) {
+        autocorrect_backspace();
+        return true;
+    }
+    return autocorrect_type(autocorrect_code(keycode));
+}
+#endif
+
+// Characters typed by a sequence are seen by autocorrect like typed keys
+static void sequence_type(uint16_t kc) {
+#ifdef AUTOCORRECT_ENABLE
+    if (!autocorrect_process(kc)) {
+        return;
+    }
+#endif
+    sequence_send(kc);
+}
+
+// The key which ended a sequence, its release is not sent either
+static bool sequence_swallow = false;
+static keypos_t sequence_swallowed;
+
+static bool sequence_end(keyrecord_t *record) {
+    sequence_swallow   = true;
+    sequence_swallowed = record->event.key;
+    return false;
+}
+
+static bool sequence_release(keyrecord_t *record) {
+    if (record->event.pressed || !sequence_swallow || !KEYEQ(record->event.key, sequence_swallowed)) {
+        return true;
+    }
+    sequence_swallow = false;
+    return false;
+}
+
+// Tap keycode of a key press which can be part of a sequence, KC_NO otherwise
+static uint16_t sequence_keycode(uint16_t keycode, keyrecord_t *record) {
+    if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) {
+        if (record->tap.count == 0) {
+            return KC_NO;
+        }
+        // & 0xFF gets the Tap key of the Tap Holds
+        keycode &= 0xFF;
+    }
+    return IS_MODIFIER_KEYCODE(keycode) ? KC_NO : keycode;
+}
+
+static uint8_t  dead_key_node     = SEQUENCE_NONE;
+static uint16_t dead_key_fallback = KC_NO;
+
+// Keys pressed after a dead key are looked up in the node of the sequence,
+// anything else cancels it and is processed as usual.
+static bool dead_key_process(uint16_t keycode, keyrecord_t *record) {
+    const bool shifted  = (get_mods() & MOD_MASK_SHIFT) != 0;
+    uint8_t    node     = dead_key_node;
+    uint16_t   fallback = dead_key_fallback;
+    dead_key_node       = SEQUENCE_NONE;
+    dead_key_fallback   = KC_NO;
+    if (node == SEQUENCE_NONE) {
+        if (keycode != CKC_DK || shifted) {
+            return true;
+        }
+        dead_key_node = SEQUENCE_DEAD_KEY;
+        return false;
+    }
+
+    // Shortcuts and the keys of the other layers, like Qwerty, are not part
+    // of a sequence
+    uint8_t i     = SEQUENCE_NONE;
+    uint8_t layer = layer_switch_get_layer(record->event.key);
+    if ((layer == VARIANT_LAYER(Base) || layer == VARIANT_LAYER(Sym)) && (get_mods() & ~MOD_MASK_SHIFT) == 0) {
+        i = sequence_find(node, keycode);
+    }
+    if (i == SEQUENCE_NONE) {
+        if (fallback != KC_NO) {
+            sequence_type(fallback);
+        }
+        return true;
+    }
+
+    // A shifted dead key ends the sequence
+    dead_key_node = pgm_read_byte(&sequence_entries[i].next);
+    if (dead_key_node != SEQUENCE_NONE && !shifted) {
+        dead_key_fallback = sequence_output(i, false);
+    } else {
+        dead_key_node = SEQUENCE_NONE;
+        sequence_type(sequence_output(i, shifted));
+    }
+    return false;
+}
+
+bool sequence_process(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed) {
+        return sequence_release(record);
+    }
+    keycode = sequence_keycode(keycode, record);
+    if (keycode == KC_NO) {
+        return true;
+    }
+    if (!dead_key_process(keycode, record)) {
+        return sequence_end(record);
+    }
+#ifdef AUTOCORRECT_ENABLE
+    if (!autocorrect_process(keycode)) {
+        return sequence_end(record);
+    }
+#endif
+    return true;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+
+// Key sequences after CKC_DK as a trie, in typing order. An entry matches a
+// keycode of the Base or Sym layer and sends `kc`, or `skc` when shifted,
+// which are unicode_map entries for UM(). With `next` the sequence can go on
+// in that node, `kc`/`skc` are sent if no key of it follows. Nothing typed
+// before the dead key is ever replaced.
+#define SEQUENCE_NONE 0xFF
+#define SEQUENCE_DEAD_KEY 0
+
+typedef struct {
+    uint16_t key;
+    uint16_t kc;
+    uint16_t skc;
+    uint8_t  next;
+} sequence_entry_t;
+
+typedef struct {
+    uint8_t offset;
+    uint8_t count;
+} sequence_node_t;
+
+// Generated with the keymap
+extern const sequence_entry_t PROGMEM sequence_entries[];
+extern const sequence_node_t PROGMEM  sequence_nodes[];
+
+#ifdef AUTOCORRECT_ENABLE
+typedef struct {
+    uint16_t keycode;
+    uint8_t  code;
+} autocorrect_key_t;
+
+// Characters of the keys in the alphabet of autocorrect_data.h, see
+// scripts/gen_autocorrect.py. The keys of the unicode_map are looked up by
+// index, the custom keys with the keycode they send, the other ones in
+// autocorrect_keys which ends with KC_NO.
+extern const uint8_t PROGMEM           autocorrect_unicode[UNICODE_MAP_COUNT];
+extern const autocorrect_key_t PROGMEM autocorrect_keys[];
+
+// Keycodes typing the characters of the corrections
+extern const uint16_t PROGMEM autocorrect_keycodes[];
+
+// Trie of each layer in autocorrect_data.h, AUTOCORRECT_NO_TRIE for none
+extern const uint8_t PROGMEM autocorrect_layer_tries[LAYER_COUNT];
+#endif
+
+// Returns false when the key was part of a sequence and must not be sent,
+// its release is not sent either
+bool sequence_process(uint16_t keycode, keyrecord_t *record);
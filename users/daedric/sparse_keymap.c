@@ -0,0 +1,36 @@
+#include "quantum.h"
+
+#include "sparse_keymap.h"
+
+static uint16_t keymap_keycode(uint8_t layer, uint8_t row, uint8_t col) {
+    if (layer >= LAYER_COUNT || row >= MATRIX_ROWS || col >= MATRIX_COLS) {
+        return KC_TRNS;
+    }
+    uint8_t key = pgm_read_byte(&keymap_positions[row][col]);
+    if (!key) {
+        return KC_NO;
+    }
+    key--;
+
+    const keymap_layer_t *l    = &keymap_layers[layer];
+    uint8_t               bits = pgm_read_byte(&l->bitmap[key / 8]);
+    uint8_t               bit  = 1 << (key % 8);
+    if (!(bits & bit)) {
+        return KC_TRNS;
+    }
+    // Rank of the key among the stored ones of the layer
+    uint16_t index = pgm_read_word(&l->offset) + pgm_read_byte(&l->rank[key / 8]) + bitpop(bits & (bit - 1));
+    return pgm_read_word(&keymap_keycodes[index]);
+}
+
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
+    return keymap_keycode(layer, key.row, key.col);
+}
+
+uint8_t keymap_layer_count(void) {
+    return LAYER_COUNT;
+}
+
+uint16_t keycode_at_keymap_location(uint8_t layer, uint8_t row, uint8_t col) {
+    return keymap_keycode(layer, row, col);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "quantum.h"
+
+// The layers of the keymaps generated by scripts/gen_keymap.py only store the
+// keys which are not KC_TRNS, in LAYOUT() order. keymap_key_to_keycode() finds
+// a key in O(1): its bit, then the keys stored before its byte and the bits set
+// below it in the byte.
+//
+// KEYMAP_KEYS, the keys of LAYOUT(), comes from layers.h.
+//
+// The keymaps[] QMK requires only has a layer of KC_NO: keymap_layer_count()
+// and keycode_at_keymap_location() are overridden to return LAYER_COUNT and
+// the keys of the sparse layers, for the features walking the keymap.
+#define KEYMAP_BLOCKS ((KEYMAP_KEYS + 7) / 8)
+
+// A bit per key which is not KC_TRNS, and the number of them before each byte
+// of the bitmap
+typedef struct {
+    uint8_t  bitmap[KEYMAP_BLOCKS];
+    uint8_t  rank[KEYMAP_BLOCKS];
+    uint16_t offset;
+} keymap_layer_t;
+
+// Generated with the keymap. Position in LAYOUT() + 1 of the key at each
+// matrix position, 0 where there is none.
+extern const uint8_t PROGMEM keymap_positions[MATRIX_ROWS][MATRIX_COLS];
+
+extern const keymap_layer_t PROGMEM keymap_layers[LAYER_COUNT];
+extern const uint16_t PROGMEM       keymap_keycodes[];
@@ -0,0 +1,62 @@
+#include "quantum.h"
+
+#include "transport.h"
+
+#ifndef TRANSPORT_WATCHDOG_INTERVAL
+#    define TRANSPORT_WATCHDOG_INTERVAL 100
+#endif
+
+#ifndef TRANSPORT_WATCHDOG_DEBOUNCE
+#    define TRANSPORT_WATCHDOG_DEBOUNCE 3
+#endif
+
+#ifdef PROTOCOL_CHIBIOS
+// The check takes well under a millisecond, use the cycle counter
+#    define transport_clock() chSysGetRealtimeCounterX()
+#    define TRANSPORT_CLOCK_TO_US(n) RTC2US(STM32_SYSCLK, n)
+#else
+#    define transport_clock() timer_read32()
+#    define TRANSPORT_CLOCK_TO_US(n) ((n) * 1000)
+#endif
+
+static bool              transport_connected = true;
+static uint8_t           transport_samples   = 0;
+static uint16_t          transport_timer     = 0;
+static transport_stats_t transport_stats     = {0};
+
+__attribute__((weak)) void transport_disconnected_user(void) {}
+__attribute__((weak)) void transport_connected_user(void) {}
+
+void transport_watchdog_task(void) {
+    if (timer_elapsed(transport_timer) < TRANSPORT_WATCHDOG_INTERVAL) {
+        return;
+    }
+    transport_timer = timer_read();
+
+    uint32_t start     = transport_clock();
+    bool     connected = is_transport_connected();
+    transport_stats.check_time += TRANSPORT_CLOCK_TO_US(transport_clock() - start);
+    transport_stats.checks++;
+
+    if (connected == transport_connected) {
+        transport_samples = 0;
+        return;
+    }
+    if (++transport_samples < TRANSPORT_WATCHDOG_DEBOUNCE) {
+        return;
+    }
+
+    transport_samples   = 0;
+    transport_connected = connected;
+    if (connected) {
+        transport_connected_user();
+    } else {
+        transport_stats.disconnects++;
+        transport_disconnected_user();
+    }
+    dprintf("transport: %s, %u disconnects, %lu us in %lu checks\n", connected ? "connected" : "disconnected", transport_stats.disconnects, transport_stats.check_time, transport_stats.checks);
+}
+
+const transport_stats_t *transport_watchdog_stats(void) {
+    return &transport_stats;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdint.h>
+
+// Watch the link to the right half, sampling it every
+// TRANSPORT_WATCHDOG_INTERVAL ms and only reporting a change once
+// TRANSPORT_WATCHDOG_DEBOUNCE samples in a row agree.
+// transport_watchdog_task() must be called from housekeeping.
+void transport_watchdog_task(void);
+
+// Called on each debounced edge
+void transport_disconnected_user(void);
+void transport_connected_user(void);
+
+typedef struct {
+    uint16_t disconnects;
+    uint32_t checks;
+    // Time spent in is_transport_connected(), in microseconds
+    uint32_t check_time;
+} transport_stats_t;
+
+const transport_stats_t *transport_watchdog_stats(void);
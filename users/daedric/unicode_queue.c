@@ -0,0 +1,358 @@
+#include "quantum.h"
+
+#include "hosts.h"
+#include "unicode_queue.h"
+
+#ifndef UNICODE_QUEUE_SIZE
+#    define UNICODE_QUEUE_SIZE 32
+#endif
+
+#ifndef UNICODE_QUEUE_STEPS
+#    define UNICODE_QUEUE_STEPS 4
+#endif
+
+// Characters, or keys typed after them
+typedef struct {
+    // unicode_map index of a character, or keycode
+    uint16_t value;
+    uint8_t  kind;
+} unicode_queue_entry_t;
+
+static unicode_queue_entry_t unicode_queue[UNICODE_QUEUE_SIZE];
+static uint8_t               unicode_queue_head = 0;
+static uint8_t               unicode_queue_len  = 0;
+static bool                  unicode_queue_busy = false;
+static uint8_t               unicode_queue_mods;
+static bool                  unicode_queue_caps;
+
+// Input sequence of the code point being typed. An op presses a keycode, or
+// releases it with UNICODE_OP_RELEASE, KC_NO waits for the host input method.
+#define UNICODE_OP_RELEASE 0x8000
+#define UNICODE_OPS_SIZE 24
+
+static uint16_t unicode_ops[UNICODE_OPS_SIZE];
+static uint8_t  unicode_ops_len  = 0;
+static uint8_t  unicode_ops_next = 0;
+static uint16_t unicode_ops_timer;
+static bool     unicode_ops_waiting = false;
+
+static unicode_cp_t unicode_map_get(uint16_t index) {
+#ifdef UNICODE_MAP_ASTRAL_FIRST
+    if (index >= UNICODE_MAP_ASTRAL_FIRST) {
+        return pgm_read_dword(&unicode_map_astral[index - UNICODE_MAP_ASTRAL_FIRST]);
+    }
+#endif
+    return pgm_read_word(&unicode_map[index]);
+}
+
+uint16_t unicode_map_index(uint16_t keycode) {
+    if (!IS_QK_UNICODEMAP_PAIR(keycode)) {
+        return QK_UNICODEMAP_GET_INDEX(keycode);
+    }
+    uint8_t mods = get_mods() | get_weak_mods() | get_oneshot_mods();
+    if (((mods & MOD_MASK_SHIFT) != 0) != host_keyboard_led_state().caps_lock) {
+        return QK_UNICODEMAP_PAIR_GET_SHIFTED_INDEX(keycode);
+    }
+    return QK_UNICODEMAP_PAIR_GET_UNSHIFTED_INDEX(keycode);
+}
+
+static void unicode_op(uint16_t op) {
+    unicode_ops[unicode_ops_len++] = op;
+}
+
+static void unicode_op_tap(uint16_t kc) {
+    unicode_op(kc);
+    unicode_op(kc | UNICODE_OP_RELEASE);
+}
+
+// Same digits as register_hex32()
+static void unicode_ops_hex(unicode_cp_t hex, uint8_t mode) {
+    bool first_digit = true;
+    for (int8_t i = 7; i >= 0; i--) {
+        uint8_t digit = (hex >> (i * 4)) & 0xF;
+        if (digit == 0 && first_digit) {
+            continue;
+        }
+        if (first_digit && digit > 9 && mode == UNICODE_MODE_WINCOMPOSE) {
+            unicode_op_tap(KC_0);
+        }
+        first_digit = false;
+        if (mode == UNICODE_MODE_WINDOWS) {
+            unicode_op_tap(digit < 10 ? KC_KP_1 + (10 + digit - 1) % 10 : KC_A + (digit - 10));
+        } else {
+            unicode_op_tap(hex_to_keycode(digit));
+        }
+    }
+}
+
+#ifndef UNICODE_KEY_COMPOSE
+// Compose key of a Linux host, compose sequences are only used on Linux when
+// it is defined
+#    define UNICODE_KEY_COMPOSE KC_NO
+#endif
+
+// Native keys of an unicode_map entry, false when the hex input is shorter
+static bool unicode_ops_route(uint16_t index) {
+    uint8_t mode = get_unicode_input_mode();
+    if (index >= UNICODE_ROUTE_COUNT || mode >= UNICODE_MODE_COUNT) {
+        return false;
+    }
+    uint16_t offset = pgm_read_word(&unicode_routes[index][mode].offset);
+    uint8_t  length = pgm_read_byte(&unicode_routes[index][mode].length);
+    if (length == 0) {
+        return false;
+    }
+
+    unicode_ops_len  = 0;
+    unicode_ops_next = 0;
+    if (length & UNICODE_ROUTE_COMPOSE) {
+        uint16_t compose = mode == UNICODE_MODE_WINCOMPOSE ? UNICODE_KEY_WINC : UNICODE_KEY_COMPOSE;
+        if (compose == KC_NO) {
+            return false;
+        }
+        unicode_op_tap(compose);
+        length &= ~UNICODE_ROUTE_COMPOSE;
+    }
+    for (uint8_t i = 0; i < length; i++) {
+        unicode_op_tap(host_keycode(pgm_read_word(&unicode_route_keys[offset + i])));
+    }
+    return true;
+}
+
+// Same sequences as register_unicode()
+static void unicode_ops_build(unicode_cp_t code_point) {
+    uint8_t mode     = get_unicode_input_mode();
+    unicode_ops_len  = 0;
+    unicode_ops_next = 0;
+    if (code_point > 0x10FFFF || (code_point > 0xFFFF && mode == UNICODE_MODE_WINDOWS)) {
+        return;
+    }
+
+    switch (mode) {
+        case UNICODE_MODE_MACOS:
+            unicode_op(UNICODE_KEY_MAC);
+            break;
+        case UNICODE_MODE_LINUX:
+            unicode_op_tap(UNICODE_KEY_LNX);
+            break;
+        case UNICODE_MODE_WINDOWS:
+            unicode_op(KC_LEFT_ALT);
+            unicode_op_tap(KC_KP_PLUS);
+            break;
+        case UNICODE_MODE_WINCOMPOSE:
+            unicode_op_tap(UNICODE_KEY_WINC);
+            unicode_op_tap(KC_U);
+            break;
+        case UNICODE_MODE_EMACS:
+            unicode_op_tap(LCTL(KC_X));
+            unicode_op_tap(KC_8);
+            unicode_op_tap(KC_ENTER);
+            break;
+    }
+    unicode_op(KC_NO);
+
+    if (code_point > 0xFFFF && mode == UNICODE_MODE_MACOS) {
+        // UTF-16 surrogate pair on macOS
+        code_point -= 0x10000;
+        unicode_ops_hex(((code_point & 0xFFC00) >> 10) + 0xD800, mode);
+        unicode_ops_hex((code_point & 0x3FF) + 0xDC00, mode);
+    } else {
+        unicode_ops_hex(code_point, mode);
+    }
+
+    switch (mode) {
+        case UNICODE_MODE_MACOS:
+            unicode_op(UNICODE_KEY_MAC | UNICODE_OP_RELEASE);
+            break;
+        case UNICODE_MODE_LINUX:
+            unicode_op_tap(KC_SPACE);
+            break;
+        case UNICODE_MODE_WINDOWS:
+            unicode_op(KC_LEFT_ALT | UNICODE_OP_RELEASE);
+            break;
+        case UNICODE_MODE_WINCOMPOSE:
+        case UNICODE_MODE_EMACS:
+            unicode_op_tap(KC_ENTER);
+            break;
+    }
+}
+
+static void unicode_key_send(uint16_t kc, uint8_t kind) {
+    const uint8_t mods = get_mods();
+    switch (kind) {
+        case UNICODE_QUEUE_PRESS:
+            register_code16(kc);
+            break;
+        case UNICODE_QUEUE_PRESS_SHIFTED:
+            add_weak_mods(MOD_BIT(KC_LSFT));
+            register_code16(kc);
+            break;
+        case UNICODE_QUEUE_PRESS_UNSHIFTED:
+            del_weak_mods(MOD_MASK_SHIFT);
+            del_oneshot_mods(MOD_MASK_SHIFT);
+            unregister_mods(MOD_MASK_SHIFT);
+            register_code16(kc);
+            set_mods(mods);
+            break;
+        case UNICODE_QUEUE_RELEASE:
+            unregister_code16(kc);
+            break;
+    }
+}
+
+// Send the next op, returns false once everything has been typed
+static bool unicode_queue_step(bool blocking) {
+    if (unicode_ops_next == unicode_ops_len) {
+        if (unicode_queue_busy && (unicode_queue_len == 0 || unicode_queue[unicode_queue_head].kind != UNICODE_QUEUE_CHAR)) {
+            // The keys after the characters get the modifiers back
+            if (unicode_queue_caps) {
+                tap_code(KC_CAPS_LOCK);
+            }
+            set_mods(unicode_queue_mods);
+            send_keyboard_report();
+            unicode_queue_busy = false;
+        }
+        if (unicode_queue_len == 0) {
+            return false;
+        }
+
+        unicode_queue_entry_t entry = unicode_queue[unicode_queue_head];
+        unicode_queue_head          = (unicode_queue_head + 1) % UNICODE_QUEUE_SIZE;
+        unicode_queue_len--;
+        if (entry.kind != UNICODE_QUEUE_CHAR) {
+            unicode_key_send(entry.value, entry.kind);
+            return true;
+        }
+
+        if (!unicode_queue_busy) {
+            // Like unicode_input_start(), the input method needs caps lock off
+            unicode_queue_caps = get_unicode_input_mode() == UNICODE_MODE_LINUX && host_keyboard_led_state().caps_lock;
+            if (unicode_queue_caps) {
+                tap_code(KC_CAPS_LOCK);
+            }
+            unicode_queue_mods = get_mods();
+            clear_mods();
+            clear_weak_mods();
+            send_keyboard_report();
+            unicode_queue_busy = true;
+        }
+
+        if (unicode_ops_route(entry.value)) {
+            return true;
+        }
+
+        unicode_ops_build(unicode_map_get(entry.value));
+        return true;
+    }
+
+    uint16_t op = unicode_ops[unicode_ops_next];
+    if (op == KC_NO) {
+        if (blocking) {
+            wait_ms(UNICODE_TYPE_DELAY);
+        } else if (!unicode_ops_waiting) {
+            unicode_ops_waiting = true;
+            unicode_ops_timer   = timer_read();
+            return true;
+        } else if (timer_elapsed(unicode_ops_timer) < UNICODE_TYPE_DELAY) {
+            return true;
+        }
+        unicode_ops_waiting = false;
+    } else if (op & UNICODE_OP_RELEASE) {
+        unregister_code16(op & ~UNICODE_OP_RELEASE);
+    } else {
+        register_code16(op);
+    }
+    unicode_ops_next++;
+    return true;
+}
+
+// Type everything still queued, before a key that can't wait behind it
+static void unicode_queue_flush(void) {
+    while (unicode_queue_step(true)) {
+    }
+}
+
+static bool unicode_queue_pending(void) {
+    return unicode_queue_busy || unicode_queue_len > 0;
+}
+
+static void unicode_queue_add(uint16_t value, uint8_t kind) {
+    if (unicode_queue_len == UNICODE_QUEUE_SIZE) {
+        unicode_queue_flush();
+    }
+    unicode_queue[(unicode_queue_head + unicode_queue_len) % UNICODE_QUEUE_SIZE] = (unicode_queue_entry_t){.value = value, .kind = kind};
+    unicode_queue_len++;
+}
+
+void unicode_queue_push(uint16_t index) {
+    unicode_queue_add(index, UNICODE_QUEUE_CHAR);
+}
+
+// Queue a key event behind the characters, false when it can be sent now
+static bool unicode_queue_key(uint16_t kc, uint8_t kind) {
+    if (!unicode_queue_pending()) {
+        return false;
+    }
+    if (IS_MODIFIER_KEYCODE(kc)) {
+        if (kind == UNICODE_QUEUE_RELEASE) {
+            // Released now, not given back after the characters
+            unicode_queue_mods &= ~MOD_BIT(kc);
+        } else {
+            // The keys processed meanwhile read the modifiers
+            unicode_queue_flush();
+        }
+        return false;
+    }
+    if (kind == UNICODE_QUEUE_RELEASE) {
+        // Only after a press which is still queued
+        bool pressed = false;
+        for (uint8_t i = 0; i < unicode_queue_len; i++) {
+            const unicode_queue_entry_t *entry = &unicode_queue[(unicode_queue_head + i) % UNICODE_QUEUE_SIZE];
+            if (entry->kind != UNICODE_QUEUE_CHAR && entry->value == kc) {
+                pressed = entry->kind != UNICODE_QUEUE_RELEASE;
+            }
+        }
+        if (!pressed) {
+            return false;
+        }
+    }
+    unicode_queue_add(kc, kind);
+    return true;
+}
+
+void unicode_queue_send(uint16_t kc, uint8_t kind) {
+    if (!unicode_queue_key(kc, kind)) {
+        unicode_key_send(kc, kind);
+    }
+}
+
+void unicode_queue_tap(uint16_t kc, uint8_t kind) {
+    unicode_queue_send(kc, kind);
+    unicode_queue_send(kc, UNICODE_QUEUE_RELEASE);
+}
+
+static bool unicode_queue_layer_key(uint16_t keycode) {
+    return IS_QK_LAYER_TAP(keycode) || IS_QK_TO(keycode) || IS_QK_MOMENTARY(keycode) || IS_QK_DEF_LAYER(keycode) || IS_QK_TOGGLE_LAYER(keycode) || IS_QK_ONE_SHOT_LAYER(keycode) || IS_QK_LAYER_TAP_TOGGLE(keycode);
+}
+
+bool unicode_queue_record(uint16_t keycode, keyrecord_t *record) {
+    if ((IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) && record->tap.count != 0) {
+        // & 0xFF gets the Tap key
+        keycode &= 0xFF;
+    } else if (keycode > QK_MODS_MAX) {
+        // Layer keys type nothing, the other ones like modifier holds can't wait
+        if (!unicode_queue_layer_key(keycode) && unicode_queue_pending()) {
+            unicode_queue_flush();
+        }
+        return true;
+    }
+    return !unicode_queue_key(keycode, record->event.pressed ? UNICODE_QUEUE_PRESS : UNICODE_QUEUE_RELEASE);
+}
+
+void matrix_scan_user(void) {
+    for (uint8_t i = 0; i < UNICODE_QUEUE_STEPS; i++) {
+        if (!unicode_queue_step(false)) {
+            break;
+        }
+    }
+}
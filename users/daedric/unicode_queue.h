@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+
+// The keymaps generated by scripts/gen_keymap.py have their own unicode_map,
+// without UNICODEMAP_ENABLE. Its entries are typed by the unicode queue: their
+// input sequences are sent UNICODE_QUEUE_STEPS keycodes per scan instead of
+// blocking the scan loop, and the modifiers are saved and restored once for
+// each batch of characters. The keys pressed and released meanwhile wait
+// behind them in the queue.
+//
+// UNICODE_MAP_COUNT, UNICODE_ROUTE_COUNT and UNICODE_MAP_ASTRAL_FIRST, when
+// there are code points above the Basic Multilingual Plane, come from
+// layers.h.
+#ifdef UNICODE_MAP_ASTRAL_FIRST
+typedef uint32_t unicode_cp_t;
+#else
+typedef uint16_t unicode_cp_t;
+#endif
+
+#define UNICODE_ROUTE_COMPOSE 0x80
+
+typedef struct {
+    uint16_t offset;
+    uint8_t  length;
+} unicode_route_t;
+
+// Generated with the keymap. unicode_map holds the code points of the Basic
+// Multilingual Plane in 16 bits, the ones above are in unicode_map_astral from
+// UNICODE_MAP_ASTRAL_FIRST.
+extern const uint16_t PROGMEM unicode_map[];
+#ifdef UNICODE_MAP_ASTRAL_FIRST
+extern const uint32_t PROGMEM unicode_map_astral[UNICODE_MAP_COUNT - UNICODE_MAP_ASTRAL_FIRST];
+#endif
+
+// Keys typing an unicode_map entry in an input mode when they are fewer than
+// its hex input sequence, from unicode_route_keys. UNICODE_ROUTE_COMPOSE in
+// the length taps the compose key first.
+extern const uint16_t PROGMEM        unicode_route_keys[];
+extern const unicode_route_t PROGMEM unicode_routes[UNICODE_ROUTE_COUNT][UNICODE_MODE_COUNT];
+
+enum unicode_queue_kinds {
+    UNICODE_QUEUE_CHAR,
+    UNICODE_QUEUE_PRESS,
+    // Pressed with shift, or without it, like by the shift engine
+    UNICODE_QUEUE_PRESS_SHIFTED,
+    UNICODE_QUEUE_PRESS_UNSHIFTED,
+    UNICODE_QUEUE_RELEASE,
+};
+
+// Same entry as unicodemap_index(), the shifted one of a pair with shift or
+// caps lock
+uint16_t unicode_map_index(uint16_t keycode);
+
+// Type an unicode_map entry
+void unicode_queue_push(uint16_t index);
+
+// Press or release `kc` after the queued characters
+void unicode_queue_send(uint16_t kc, uint8_t kind);
+void unicode_queue_tap(uint16_t kc, uint8_t kind);
+
+// Whether QMK processes a key it sends, the basic keys and the taps of Tap
+// Holds wait behind the queued characters instead
+bool unicode_queue_record(uint16_t keycode, keyrecord_t *record);
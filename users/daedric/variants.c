@@ -0,0 +1,34 @@
+#include "quantum.h"
+
+#include "variants.h"
+
+static const uint8_t PROGMEM variant_bases[VARIANT_COUNT]        = VARIANT_LAYERS_Base;
+static const uint8_t PROGMEM variant_layer_indices[LAYER_COUNT] = VARIANT_LAYER_INDEX;
+
+uint8_t variant_get(layer_state_t default_state) {
+    for (uint8_t variant = 0; variant < VARIANT_COUNT; variant++) {
+        if (IS_LAYER_ON_STATE(default_state, pgm_read_byte(&variant_bases[variant]))) {
+            return variant;
+        }
+    }
+    return 0;
+}
+
+void variant_init(void) {
+    uint8_t base = pgm_read_byte(&variant_bases[variant_current()]);
+    if (default_layer_state != ((layer_state_t)1 << base)) {
+        set_single_persistent_default_layer(base);
+    }
+}
+
+void variant_next(void) {
+    uint8_t next = (variant_current() + 1) % VARIANT_COUNT;
+    // The layers held or moved to belong to the previous one
+    layer_clear();
+    set_single_persistent_default_layer(pgm_read_byte(&variant_bases[next]));
+    dprintf("variant: %u\n", next);
+}
+
+uint8_t variant_layer_index(uint8_t layer) {
+    return layer < LAYER_COUNT ? pgm_read_byte(&variant_layer_indices[layer]) : 0;
+}
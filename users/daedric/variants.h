@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "action_layer.h"
+
+// Several keymaps generated by scripts/gen_keymap.py in one firmware, the
+// variants, each one with its own layers.
+//
+// Their base layers go first and the variant in use is the default layer:
+// QMK restores it from EEPROM at boot and default_layer_state_set_user() sees
+// the switches. The combo generated with the keymap calls variant_next().
+//
+// layers.h of the keymap has the layer of each mode in every variant,
+// VARIANT_LAYERS_<mode>, the firmware of a single keymap is its only variant.
+// VARIANT_LAYER_INDEX numbers the layers of each variant from its base.
+
+// Value of `variant` in one of the VARIANT_* tables of layers.h
+#define VARIANT_OF(table, variant) (((const uint8_t[])table)[variant])
+
+// Layer of `mode` in the variant in use, VARIANT_NO_LAYER when it has none
+#define VARIANT_LAYER(mode) VARIANT_OF(VARIANT_LAYERS_##mode, variant_current())
+
+// Variant of a default layer state, the first one when it is none of them
+uint8_t variant_get(layer_state_t default_state);
+
+static inline uint8_t variant_current(void) {
+    return variant_get(default_layer_state);
+}
+
+// A default layer which is not a base layer, left in EEPROM by another
+// firmware, goes back to the first variant. Called from keyboard_post_init_user().
+void variant_init(void);
+
+// Switch to the next variant and keep it in EEPROM
+void variant_next(void);
+
+// Index of `layer` among the layers of its variant, 0 for the base layer
+uint8_t variant_layer_index(uint8_t layer);